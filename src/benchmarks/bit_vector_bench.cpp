@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../vector/s21_bit_vector.h"
+#include "../vector/s21_vector.h"
+
+// BitVector против Vector<bool> (байт на флаг) и std::vector<bool>.
+// state.range(0) - число бит; bytes_per_second считается по памяти
+// BitVector, чтобы сравнить с пропускной способностью памяти.
+
+static s21::BitVector make_bits(size_t n, unsigned seed)
+{
+    std::mt19937_64 rng(seed);
+    s21::BitVector bits(n);
+    for (size_t i = 0; i < n; i += 64)
+    {
+        uint64_t word = rng();
+        for (size_t j = i; j < n && j < i + 64; ++j)
+        {
+            bits[j] = (word >> (j - i)) & 1;
+        }
+    }
+    return bits;
+}
+
+static void BM_BitVectorCount(benchmark::State &state)
+{
+    s21::BitVector bits = make_bits(state.range(0), 1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bits.count());
+    }
+    state.SetBytesProcessed(state.iterations() * bits.word_count() * 8);
+    state.counters["bytes"] = double(bits.word_count() * 8);
+}
+
+static void BM_VectorBoolCount(benchmark::State &state)
+{
+    s21::Vector<bool> flags(state.range(0));
+    s21::BitVector bits = make_bits(state.range(0), 1);
+    for (size_t i = 0; i < flags.size(); ++i)
+    {
+        flags[i] = bits[i];
+    }
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < flags.size(); ++i)
+        {
+            count += flags[i];
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+    state.counters["bytes"] = double(flags.size());
+}
+
+static void BM_StdVectorBoolCount(benchmark::State &state)
+{
+    std::vector<bool> flags(state.range(0));
+    s21::BitVector bits = make_bits(state.range(0), 1);
+    for (size_t i = 0; i < flags.size(); ++i)
+    {
+        flags[i] = bits[i];
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::count(flags.begin(), flags.end(), true));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+
+static void BM_BitVectorAnd(benchmark::State &state)
+{
+    s21::BitVector a = make_bits(state.range(0), 1);
+    s21::BitVector b = make_bits(state.range(0), 2);
+    for (auto _ : state)
+    {
+        a &= b;
+        a ^= b;
+        benchmark::DoNotOptimize(a.data());
+    }
+    // два прохода по двум операндам
+    state.SetBytesProcessed(state.iterations() * a.word_count() * 8 * 4);
+}
+
+static void BM_StdVectorBoolAnd(benchmark::State &state)
+{
+    std::vector<bool> a(state.range(0));
+    std::vector<bool> b(state.range(0), true);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            a[i] = a[i] && b[i];
+        }
+        benchmark::DoNotOptimize(&a);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 8 * 2);
+}
+
+static void BM_BitVectorFindNext(benchmark::State &state)
+{
+    s21::BitVector bits(state.range(0));
+    for (size_t i = 0; i < bits.size(); i += 997)
+    {
+        bits[i] = true;
+    }
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (size_t i = bits.find_first(); i != s21::BitVector::npos; i = bits.find_next(i))
+        {
+            ++found;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetBytesProcessed(state.iterations() * bits.word_count() * 8);
+}
+
+#define RANGES ->RangeMultiplier(64)->Range(1 << 16, 1 << 28)
+
+BENCHMARK(BM_BitVectorCount) RANGES;
+BENCHMARK(BM_VectorBoolCount) RANGES;
+BENCHMARK(BM_StdVectorBoolCount) RANGES;
+BENCHMARK(BM_BitVectorAnd) RANGES;
+BENCHMARK(BM_StdVectorBoolAnd) RANGES;
+BENCHMARK(BM_BitVectorFindNext) RANGES;
+
+BENCHMARK_MAIN();
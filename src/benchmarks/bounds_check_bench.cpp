@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "../vector/s21_vector.h"
+
+// Цикл по Vector::operator[] при разных режимах S21_BOUNDS_CHECK.
+// Режим фиксируется при сборке, поэтому бенчмарк собирается дважды:
+//   g++ -O3 -DS21_BOUNDS_CHECK=0 -fopt-info-vec-optimized ...
+//   g++ -O3 -DS21_BOUNDS_CHECK=1 -fopt-info-vec-optimized ...
+// В режиме 0 векторизуются оба цикла. С проверкой векторизуется только
+// сумма (условие цикла совпадает с проверкой, и GCC её убирает); в saxpy
+// индекс проверяется и по x, и по y, и цикл остаётся скалярным.
+
+static void BM_IndexSum(benchmark::State &state)
+{
+    s21::Vector<int32_t> v(state.range(0));
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = static_cast<int32_t>(i);
+    }
+    for (auto _ : state)
+    {
+        int32_t sum = 0;
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            sum += v[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * v.size() * sizeof(int32_t));
+    state.SetLabel("S21_BOUNDS_CHECK=" + std::to_string(S21_BOUNDS_CHECK));
+}
+
+static void BM_IndexSaxpy(benchmark::State &state)
+{
+    s21::Vector<float> x(state.range(0));
+    s21::Vector<float> y(state.range(0));
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] += 2.0f * x[i];
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetBytesProcessed(state.iterations() * x.size() * 2 * sizeof(float));
+    state.SetLabel("S21_BOUNDS_CHECK=" + std::to_string(S21_BOUNDS_CHECK));
+}
+
+BENCHMARK(BM_IndexSum)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_IndexSaxpy)->Arg(1 << 12)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
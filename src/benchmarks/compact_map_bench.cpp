@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "../map/s21_compact_map.h"
+#include "../map/s21_map.h"
+
+// s21::CompactMap против s21::Map и std::map с ключами int:
+// память на элемент и поиск существующих ключей. Ключи вставляются в
+// случайном порядке. bytes_per_elem - прирост занятой кучи (glibc
+// mallinfo2, вместе с заголовками malloc), делённый на число
+// элементов. Большие буферы s21::Vector отображает страницами мимо
+// malloc, поэтому для CompactMap берётся memory_bytes() (вместе с
+// запасом ёмкости). state.range(0) - число ключей.
+
+static size_t heap_in_use()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+static std::vector<int> shuffled(size_t n)
+{
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        keys[i] = static_cast<int>(i * 3);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(7));
+    return keys;
+}
+
+template <typename Map>
+static size_t footprint(const Map &, size_t heap_delta)
+{
+    return heap_delta;
+}
+
+static size_t footprint(const s21::CompactMap<int, int> &m, size_t)
+{
+    return m.memory_bytes();
+}
+
+template <typename Map>
+static void BM_Find(benchmark::State &state)
+{
+    auto keys = shuffled(state.range(0));
+    size_t before = heap_in_use();
+    Map m;
+    for (int key : keys)
+    {
+        m.insert({key, key});
+    }
+    size_t used = footprint(m, heap_in_use() - before);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m.find(keys[i])->second);
+        i = i + 1 == keys.size() ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_elem"] = static_cast<double>(used) / keys.size();
+}
+
+template <typename Map>
+static void BM_Insert(benchmark::State &state)
+{
+    const auto keys = shuffled(state.range(0));
+    for (auto _ : state)
+    {
+        Map m;
+        for (int key : keys)
+        {
+            m.insert({key, key});
+        }
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+using Compact = s21::CompactMap<int, int>;
+using Tree = s21::Map<int, int>;
+using Std = std::map<int, int>;
+
+#define RANGES ->RangeMultiplier(16)->Range(1 << 12, 1 << 22)
+
+BENCHMARK_TEMPLATE(BM_Find, Tree) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, Std) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, Compact) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, Tree) RANGES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Insert, Std) RANGES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Insert, Compact) RANGES->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+
+#include "../parallel/s21_concurrent_vector.h"
+#include "../vector/s21_vector.h"
+
+// Добавление из 1..N потоков в общий контейнер: ConcurrentVector
+// против Vector под std::mutex. Каждый поток добавляет
+// state.range(0) элементов за итерацию; число итераций фиксировано,
+// чтобы контейнер не рос без предела. Контейнер очищается первым
+// потоком до старта замера.
+
+static s21::ConcurrentVector<uint64_t> g_concurrent;
+static s21::Vector<uint64_t> g_locked;
+static std::mutex g_mutex;
+
+static void BM_ConcurrentPush(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        g_concurrent.clear();
+    }
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            benchmark::DoNotOptimize(g_concurrent.push_back(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_MutexPush(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        g_locked.clear();
+    }
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            g_locked.push_back(i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ConcurrentPush)->Arg(1024)->Iterations(1000)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MutexPush)->Arg(1024)->Iterations(1000)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
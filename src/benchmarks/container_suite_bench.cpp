@@ -0,0 +1,340 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "../set/s21_set.h"
+#include "../vector/s21_vector.h"
+
+// Общий набор замеров s21::Vector, s21::Map и s21::Set против
+// std::vector, std::map и std::set:
+//   Insert<Order> - наполнение n ключами по возрастанию, по убыванию
+//                   и в случайном порядке (для векторов - push_back)
+//   FindHit/Miss  - поиск существующего и отсутствующего ключа
+//                   (для векторов - binary_search по отсортированным)
+//   Iterate       - проход по всем элементам
+//   Erase         - удаление всех ключей в случайном порядке
+//                   (для векторов - pop_back до пустого)
+//   Copy          - конструктор копирования
+//   Destroy       - деструктор наполненного контейнера
+// Ключи - int, std::string длиной 20 символов (не влезает в SSO) и
+// 64-байтная POD-структура; state.range(0) - число элементов,
+// от 1e3 до 1e7.
+//
+// s21::Tree не балансируется: упорядоченная вставка и копирование
+// (копия вставляет элементы по порядку) строят цепочку и стоят
+// O(n^2), поэтому для s21::Map и s21::Set эти замеры ограничены 1e4.
+//
+// Сборка и запуск:
+//   g++ -std=c++17 -O2 -DNDEBUG benchmarks/container_suite_bench.cpp
+//       -lbenchmark -pthread -o container_suite
+//   ./container_suite --benchmark_filter='Map<int'
+// Результаты печатаются в консоль и пишутся в container_suite.json;
+// --benchmark_out=<файл> задаёт другой файл.
+
+struct Pod64
+{
+    uint64_t words[8];
+
+    bool operator==(const Pod64 &other) const { return words[0] == other.words[0]; }
+    bool operator!=(const Pod64 &other) const { return words[0] != other.words[0]; }
+    bool operator<(const Pod64 &other) const { return words[0] < other.words[0]; }
+    bool operator<=(const Pod64 &other) const { return words[0] <= other.words[0]; }
+    bool operator>(const Pod64 &other) const { return words[0] > other.words[0]; }
+};
+
+template <typename T>
+static T make_key(uint64_t i);
+
+template <>
+int make_key<int>(uint64_t i)
+{
+    return static_cast<int>(i);
+}
+
+template <>
+std::string make_key<std::string>(uint64_t i)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "key-%016llu", static_cast<unsigned long long>(i));
+    return buf;
+}
+
+template <>
+Pod64 make_key<Pod64>(uint64_t i)
+{
+    Pod64 key{};
+    for (uint64_t &word : key.words)
+    {
+        word = i;
+    }
+    return key;
+}
+
+enum Order
+{
+    kSorted,
+    kReverse,
+    kRandom
+};
+
+// чётные ключи присутствуют в контейнере, нечётные - нет
+template <typename T>
+static std::vector<T> make_keys(size_t n, Order order, bool present = true)
+{
+    std::vector<uint64_t> ids(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        ids[i] = 2 * i + (present ? 0 : 1);
+    }
+    if (order == kReverse)
+    {
+        std::reverse(ids.begin(), ids.end());
+    }
+    else if (order == kRandom)
+    {
+        std::shuffle(ids.begin(), ids.end(), std::mt19937_64(42));
+    }
+    std::vector<T> keys;
+    keys.reserve(n);
+    for (uint64_t id : ids)
+    {
+        keys.push_back(make_key<T>(id));
+    }
+    return keys;
+}
+
+// единый интерфейс к контейнерам разных семейств
+
+template <typename T>
+static void put(s21::Vector<T> &c, const T &key) { c.push_back(key); }
+template <typename T>
+static void put(std::vector<T> &c, const T &key) { c.push_back(key); }
+template <typename K>
+static void put(s21::Map<K, int> &c, const K &key) { c.insert({key, 0}); }
+template <typename K>
+static void put(std::map<K, int> &c, const K &key) { c.insert({key, 0}); }
+template <typename K>
+static void put(s21::Set<K> &c, const K &key) { c.insert(key); }
+template <typename K>
+static void put(std::set<K> &c, const K &key) { c.insert(key); }
+
+template <typename T>
+static bool found(s21::Vector<T> &c, const T &key)
+{
+    return std::binary_search(c.begin(), c.end(), key);
+}
+template <typename T>
+static bool found(std::vector<T> &c, const T &key)
+{
+    return std::binary_search(c.begin(), c.end(), key);
+}
+template <typename K>
+static bool found(s21::Map<K, int> &c, const K &key) { return c.contains(key); }
+template <typename K>
+static bool found(std::map<K, int> &c, const K &key) { return c.find(key) != c.end(); }
+template <typename K>
+static bool found(s21::Set<K> &c, const K &key) { return c.contains(key); }
+template <typename K>
+static bool found(std::set<K> &c, const K &key) { return c.find(key) != c.end(); }
+
+template <typename T>
+static void remove(s21::Vector<T> &c, const T &) { c.pop_back(); }
+template <typename T>
+static void remove(std::vector<T> &c, const T &) { c.pop_back(); }
+template <typename K>
+static void remove(s21::Map<K, int> &c, const K &key) { c.erase(c.find(key)); }
+template <typename K>
+static void remove(std::map<K, int> &c, const K &key) { c.erase(key); }
+template <typename K>
+static void remove(s21::Set<K> &c, const K &key) { c.erase(c.find(key)); }
+template <typename K>
+static void remove(std::set<K> &c, const K &key) { c.erase(key); }
+
+template <typename C, typename T>
+static std::unique_ptr<C> build(const std::vector<T> &keys)
+{
+    auto c = std::make_unique<C>();
+    for (const T &key : keys)
+    {
+        put(*c, key);
+    }
+    return c;
+}
+
+// векторы ищут двоичным поиском и должны быть отсортированы,
+// деревья s21 строятся из случайного порядка, чтобы не выродиться
+template <typename C, typename T>
+static std::unique_ptr<C> build_for_lookup(size_t n)
+{
+    constexpr bool sequence = std::is_same_v<C, s21::Vector<T>> ||
+                              std::is_same_v<C, std::vector<T>>;
+    return build<C>(make_keys<T>(n, sequence ? kSorted : kRandom));
+}
+
+template <typename C, typename T, Order order>
+static void BM_Insert(benchmark::State &state)
+{
+    const auto keys = make_keys<T>(state.range(0), order);
+    for (auto _ : state)
+    {
+        auto c = build<C>(keys);
+        benchmark::DoNotOptimize(c.get());
+        state.PauseTiming();
+        c.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename C, typename T, bool hit>
+static void BM_Find(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    auto c = build_for_lookup<C, T>(n);
+    const auto probes = make_keys<T>(std::min<size_t>(n, 1 << 16), kRandom, hit);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(found(*c, probes[i]));
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename C, typename T>
+static void BM_Iterate(benchmark::State &state)
+{
+    auto c = build_for_lookup<C, T>(state.range(0));
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (auto it = c->begin(); it != c->end(); ++it)
+        {
+            benchmark::DoNotOptimize(&*it);
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename C, typename T>
+static void BM_Erase(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    const auto build_keys = make_keys<T>(n, kRandom);
+    auto erase_keys = build_keys;
+    std::shuffle(erase_keys.begin(), erase_keys.end(), std::mt19937_64(7));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto c = build<C>(build_keys);
+        state.ResumeTiming();
+        for (const T &key : erase_keys)
+        {
+            remove(*c, key);
+        }
+        benchmark::DoNotOptimize(c.get());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename C, typename T>
+static void BM_Copy(benchmark::State &state)
+{
+    auto c = build_for_lookup<C, T>(state.range(0));
+    for (auto _ : state)
+    {
+        auto copy = std::make_unique<C>(*c);
+        benchmark::DoNotOptimize(copy.get());
+        state.PauseTiming();
+        copy.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename C, typename T>
+static void BM_Destroy(benchmark::State &state)
+{
+    const auto keys = make_keys<T>(state.range(0), kRandom);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto c = build<C>(keys);
+        state.ResumeTiming();
+        c.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+#define FULL ->RangeMultiplier(10)->Range(1000, 10000000)->Unit(benchmark::kMicrosecond)
+#define CHAIN ->RangeMultiplier(10)->Range(1000, 10000)->Unit(benchmark::kMicrosecond)
+
+// ORDERED - упорядоченная вставка и копирование, для деревьев s21 - CHAIN
+#define SUITE(C, T, ORDERED)                                       \
+    BENCHMARK_TEMPLATE(BM_Insert, C, T, kSorted) ORDERED;          \
+    BENCHMARK_TEMPLATE(BM_Insert, C, T, kReverse) ORDERED;         \
+    BENCHMARK_TEMPLATE(BM_Insert, C, T, kRandom) FULL;             \
+    BENCHMARK_TEMPLATE(BM_Find, C, T, true) FULL;                  \
+    BENCHMARK_TEMPLATE(BM_Find, C, T, false) FULL;                 \
+    BENCHMARK_TEMPLATE(BM_Iterate, C, T) FULL;                     \
+    BENCHMARK_TEMPLATE(BM_Erase, C, T) FULL;                       \
+    BENCHMARK_TEMPLATE(BM_Copy, C, T) ORDERED;                     \
+    BENCHMARK_TEMPLATE(BM_Destroy, C, T) FULL
+
+#define PAYLOADS(MAKE, ORDERED)   \
+    SUITE(MAKE(int), int, ORDERED); \
+    SUITE(MAKE(std::string), std::string, ORDERED); \
+    SUITE(MAKE(Pod64), Pod64, ORDERED)
+
+#define S21_VECTOR(T) s21::Vector<T>
+#define STD_VECTOR(T) std::vector<T>
+#define S21_MAP(T) s21::Map<T, int>
+#define STD_MAP(T) std::map<T, int>
+#define S21_SET(T) s21::Set<T>
+#define STD_SET(T) std::set<T>
+
+PAYLOADS(S21_VECTOR, FULL);
+PAYLOADS(STD_VECTOR, FULL);
+PAYLOADS(S21_MAP, CHAIN);
+PAYLOADS(STD_MAP, FULL);
+PAYLOADS(S21_SET, CHAIN);
+PAYLOADS(STD_SET, FULL);
+
+// по умолчанию, помимо консоли, результаты пишутся в JSON
+int main(int argc, char **argv)
+{
+    std::vector<char *> args(argv, argv + argc);
+    bool has_out = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        has_out = has_out || std::strncmp(argv[i], "--benchmark_out=", 16) == 0;
+    }
+    static char out[] = "--benchmark_out=container_suite.json";
+    static char format[] = "--benchmark_out_format=json";
+    if (!has_out)
+    {
+        args.push_back(out);
+        args.push_back(format);
+    }
+    int count = static_cast<int>(args.size());
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
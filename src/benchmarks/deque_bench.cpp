@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <deque>
+
+#include "../deque/s21_deque.h"
+#include "../vector/s21_vector.h"
+
+// Наполнение через push_back и последующий проход по всем элементам
+// для s21::Deque, s21::Vector и std::deque; push_front - только для
+// очередей. state.range(0) - число элементов.
+
+struct Payload
+{
+    uint64_t words[8];
+};
+
+template <typename Container, typename T>
+static void BM_Append(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    for (auto _ : state)
+    {
+        Container c;
+        for (size_t i = 0; i < n; ++i)
+        {
+            c.push_back(T{i});
+        }
+        benchmark::DoNotOptimize(&c.back());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Container>
+static void BM_PushFront(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    for (auto _ : state)
+    {
+        Container c;
+        for (size_t i = 0; i < n; ++i)
+        {
+            c.push_front(i);
+        }
+        benchmark::DoNotOptimize(&c.front());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Container>
+static void BM_Iterate(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    Container c;
+    for (size_t i = 0; i < n; ++i)
+    {
+        c.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (uint64_t x : c)
+        {
+            sum += x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define RANGES ->RangeMultiplier(16)->Range(1 << 10, 1 << 22)
+
+BENCHMARK_TEMPLATE(BM_Append, s21::Deque<uint64_t>, uint64_t) RANGES;
+BENCHMARK_TEMPLATE(BM_Append, s21::Vector<uint64_t>, uint64_t) RANGES;
+BENCHMARK_TEMPLATE(BM_Append, std::deque<uint64_t>, uint64_t) RANGES;
+BENCHMARK_TEMPLATE(BM_Append, s21::Deque<Payload>, Payload) RANGES;
+BENCHMARK_TEMPLATE(BM_Append, s21::Vector<Payload>, Payload) RANGES;
+BENCHMARK_TEMPLATE(BM_Append, std::deque<Payload>, Payload) RANGES;
+BENCHMARK_TEMPLATE(BM_PushFront, s21::Deque<uint64_t>) RANGES;
+BENCHMARK_TEMPLATE(BM_PushFront, std::deque<uint64_t>) RANGES;
+BENCHMARK_TEMPLATE(BM_Iterate, s21::Deque<uint64_t>) RANGES;
+BENCHMARK_TEMPLATE(BM_Iterate, s21::Vector<uint64_t>) RANGES;
+BENCHMARK_TEMPLATE(BM_Iterate, std::deque<uint64_t>) RANGES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../frozen/s21_frozen_index.h"
+#include "../map/s21_map.h"
+
+// Поиск случайных существующих ключей: s21::Map (узлы с указателями,
+// дерево из вставок в случайном порядке), FrozenIndex из Map::freeze()
+// и std::lower_bound по отсортированному массиву пар.
+// state.range(0) - число ключей.
+
+static std::vector<int> shuffled_keys(size_t keys)
+{
+    std::vector<int> order(keys);
+    for (size_t i = 0; i < keys; ++i)
+    {
+        order[i] = static_cast<int>(i * 2);
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(7));
+    return order;
+}
+
+static std::vector<int> make_queries(size_t keys)
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> uniform(0, keys - 1);
+    std::vector<int> queries(1 << 20);
+    for (int &q : queries)
+    {
+        q = static_cast<int>(uniform(rng) * 2);
+    }
+    return queries;
+}
+
+static void BM_Tree(benchmark::State &state)
+{
+    s21::Map<int, int> m;
+    for (int key : shuffled_keys(state.range(0)))
+    {
+        m.insert({key, key});
+    }
+    const auto queries = make_queries(state.range(0));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m.find(queries[i])->second);
+        i = (i + 1) & (queries.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Frozen(benchmark::State &state)
+{
+    s21::Map<int, int> m;
+    for (int key : shuffled_keys(state.range(0)))
+    {
+        m.insert({key, key});
+    }
+    const auto frozen = m.freeze();
+    m.clear();
+    const auto queries = make_queries(state.range(0));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(frozen.find(queries[i])->second);
+        i = (i + 1) & (queries.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SortedArray(benchmark::State &state)
+{
+    std::vector<std::pair<int, int>> sorted;
+    for (int key : shuffled_keys(state.range(0)))
+    {
+        sorted.emplace_back(key, key);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    const auto queries = make_queries(state.range(0));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), queries[i],
+                                   [](const std::pair<int, int> &item, int key)
+                                   { return item.first < key; });
+        benchmark::DoNotOptimize(it->second);
+        i = (i + 1) & (queries.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define RANGES ->RangeMultiplier(16)->Range(1 << 10, 1 << 22)
+
+BENCHMARK(BM_Tree) RANGES;
+BENCHMARK(BM_Frozen) RANGES;
+BENCHMARK(BM_SortedArray) RANGES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../map/s21_map.h"
+
+// Поиск в s21::Map<std::string, int> с префиксом ключа в узлах
+// (по умолчанию) и без него (NoKeyPrefix). Ключи вставляются в
+// случайном порядке, ищутся существующие. state.range(0) - число
+// ключей.
+//   Url   - общий префикс "https://" длиннее 8 байт, дальше хост;
+//   Path  - пути файловой системы с разными первыми каталогами;
+//   Word  - случайные строки из 24 букв.
+
+struct Url
+{
+    static std::string make(std::mt19937_64 &rng, size_t i)
+    {
+        static const char *hosts[] = {"www.example.com", "api.example.com", "cdn.example.net",
+                                      "docs.example.org"};
+        return std::string("https://") + hosts[rng() % 4] + "/section" +
+               std::to_string(rng() % 64) + "/item/" + std::to_string(i);
+    }
+};
+
+struct Path
+{
+    static std::string make(std::mt19937_64 &rng, size_t i)
+    {
+        static const char *roots[] = {"/usr/lib/", "/usr/share/", "/home/", "/var/log/",
+                                      "/opt/", "/etc/", "/srv/data/", "/tmp/"};
+        return roots[rng() % 8] + std::to_string(rng() % 1000) + "/file" + std::to_string(i);
+    }
+};
+
+struct Word
+{
+    static std::string make(std::mt19937_64 &rng, size_t)
+    {
+        std::string word(24, 'a');
+        for (char &c : word)
+        {
+            c = static_cast<char>('a' + rng() % 26);
+        }
+        return word;
+    }
+};
+
+template <typename Prefix, typename Keys>
+static void BM_Find(benchmark::State &state)
+{
+    std::mt19937_64 rng(7);
+    std::vector<std::string> keys(state.range(0));
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = Keys::make(rng, i);
+    }
+    s21::Map<std::string, int, s21::trace::NoTrace, Prefix> m;
+    for (const auto &key : keys)
+    {
+        m.insert({key, 1});
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m.find(keys[i])->second);
+        i = i + 1 == keys.size() ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using With = s21::KeyPrefix<std::string>;
+using Without = s21::NoKeyPrefix;
+
+#define RANGES ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+
+BENCHMARK_TEMPLATE(BM_Find, Without, Url) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, With, Url) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, Without, Path) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, With, Path) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, Without, Word) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, With, Word) RANGES;
+
+BENCHMARK_MAIN();
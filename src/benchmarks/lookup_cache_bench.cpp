@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../map/s21_map.h"
+
+// Поиск в s21::Map с кэшем горячих ключей и без него. Дерево
+// строится вставкой в случайном порядке, ключи запросов - Zipf по
+// рангу (ранги перемешаны) или равномерно. state.range(0) - число
+// ключей, state.range(1) - ячеек кэша (0 - без кэша).
+
+static std::vector<int> make_queries(size_t keys, double s, size_t count)
+{
+    std::mt19937_64 rng(42);
+    std::vector<int> rank_to_key(keys);
+    for (size_t i = 0; i < keys; ++i)
+    {
+        rank_to_key[i] = static_cast<int>(i);
+    }
+    std::shuffle(rank_to_key.begin(), rank_to_key.end(), rng);
+
+    std::vector<int> queries(count);
+    if (s == 0)
+    {
+        std::uniform_int_distribution<size_t> uniform(0, keys - 1);
+        for (int &q : queries)
+        {
+            q = rank_to_key[uniform(rng)];
+        }
+        return queries;
+    }
+    std::vector<double> cdf(keys);
+    double sum = 0;
+    for (size_t i = 0; i < keys; ++i)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+        cdf[i] = sum;
+    }
+    std::uniform_real_distribution<double> uniform(0, sum);
+    for (int &q : queries)
+    {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        q = rank_to_key[std::min(rank, keys - 1)];
+    }
+    return queries;
+}
+
+template <size_t Ways, int ZipfPercent>
+static void BM_Find(benchmark::State &state)
+{
+    const size_t keys = state.range(0);
+    s21::Map<int, int> m;
+    std::vector<int> order(keys);
+    for (size_t i = 0; i < keys; ++i)
+    {
+        order[i] = static_cast<int>(i);
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(7));
+    for (int key : order)
+    {
+        m.insert({key, key});
+    }
+    m.set_lookup_cache(state.range(1), Ways);
+    const auto queries = make_queries(keys, ZipfPercent / 100.0, 1 << 20);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m.find(queries[i]));
+        i = (i + 1) & (queries.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+    auto cache = m.lookup_cache_stats();
+    if (cache.hits + cache.misses)
+    {
+        state.counters["hit_rate"] = static_cast<double>(cache.hits) / (cache.hits + cache.misses);
+    }
+}
+
+#define RANGES ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {0, 256, 4096}})
+
+BENCHMARK_TEMPLATE(BM_Find, 1, 99) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, 2, 99) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, 1, 0) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, 2, 0) RANGES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../vector/s21_mapped_vector.h"
+#include "../vector/s21_vector.h"
+
+// Время "старта" на файле из state.range(0) МБ записей по 64 байта:
+// чтение через ifstream + push_back против открытия MappedVector.
+// Полный проход по данным замеряется отдельно (Scan).
+
+struct Record
+{
+    long long fields[8];
+};
+
+static std::string make_file(size_t mb)
+{
+    std::string path = "/tmp/s21_mapped_bench_" + std::to_string(mb) + ".bin";
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    size_t n = (mb << 20) / sizeof(Record);
+    if (probe && size_t(probe.tellg()) == n * sizeof(Record))
+    {
+        return path;
+    }
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    Record r{};
+    for (size_t i = 0; i < n; ++i)
+    {
+        r.fields[0] = static_cast<long long>(i);
+        out.write(reinterpret_cast<const char *>(&r), sizeof(r));
+    }
+    return path;
+}
+
+static void BM_LoadPushBack(benchmark::State &state)
+{
+    std::string path = make_file(state.range(0));
+    for (auto _ : state)
+    {
+        std::ifstream in(path, std::ios::binary);
+        s21::Vector<Record> v;
+        Record r;
+        while (in.read(reinterpret_cast<char *>(&r), sizeof(r)))
+        {
+            v.push_back(r);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+static void BM_OpenMapped(benchmark::State &state)
+{
+    std::string path = make_file(state.range(0));
+    for (auto _ : state)
+    {
+        s21::MappedVector<Record> v(path);
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+static void BM_OpenMappedScan(benchmark::State &state)
+{
+    std::string path = make_file(state.range(0));
+    for (auto _ : state)
+    {
+        s21::MappedVector<Record> v(path, s21::MapMode::kReadOnly,
+                                    s21::MapAccess::kSequential);
+        long long sum = 0;
+        for (const Record &r : v)
+        {
+            sum += r.fields[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_LoadPushBack)->Arg(16)->Arg(256)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OpenMapped)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_OpenMappedScan)->Arg(16)->Arg(256)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+#include "../parallel/s21_parallel.h"
+
+// Масштабирование параллельных алгоритмов по числу потоков пула:
+// state.range(0) - число потоков (1..hardware_concurrency),
+// 1 << 23 элементов, grain по умолчанию.
+
+static const size_t kSize = size_t(1) << 23;
+
+static s21::Vector<double> make_data()
+{
+    s21::Vector<double> v(kSize);
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        v[i] = static_cast<double>((i * 2654435761U) % 1000003);
+    }
+    return v;
+}
+
+static void BM_ParallelSort(benchmark::State &state)
+{
+    s21::ThreadPool pool(state.range(0));
+    const s21::Vector<double> source = make_data();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        s21::Vector<double> v(source);
+        state.ResumeTiming();
+        s21::parallel_sort(v, std::less<>(), s21::kDefaultGrain, pool);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+static void BM_ParallelFor(benchmark::State &state)
+{
+    s21::ThreadPool pool(state.range(0));
+    s21::Vector<double> v = make_data();
+    for (auto _ : state)
+    {
+        s21::parallel_for(v, [](double &x)
+                          { x = std::sqrt(x + 1.0); }, s21::kDefaultGrain, pool);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+static void BM_ParallelTransform(benchmark::State &state)
+{
+    s21::ThreadPool pool(state.range(0));
+    s21::Vector<double> v = make_data();
+    s21::Vector<double> out;
+    for (auto _ : state)
+    {
+        s21::parallel_transform(v, out, [](double x)
+                                { return std::log1p(x); }, s21::kDefaultGrain, pool);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+static void BM_ParallelReduce(benchmark::State &state)
+{
+    s21::ThreadPool pool(state.range(0));
+    s21::Vector<double> v = make_data();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            s21::parallel_reduce(v, 0.0, std::plus<>(), s21::kDefaultGrain, pool));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+static void thread_counts(benchmark::internal::Benchmark *b)
+{
+    int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int t = 1; t < max_threads; t *= 2)
+    {
+        b->Arg(t);
+    }
+    b->Arg(max_threads);
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(BM_ParallelSort)->Apply(thread_counts);
+BENCHMARK(BM_ParallelFor)->Apply(thread_counts);
+BENCHMARK(BM_ParallelTransform)->Apply(thread_counts);
+BENCHMARK(BM_ParallelReduce)->Apply(thread_counts);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "../map/s21_radix_map.h"
+
+// s21::RadixMap против s21::Map и std::map: построение вставкой
+// в случайном порядке и поиск существующих ключей.
+// Наборы ключей: плотные целые 0..n-1, разреженные случайные 64-битные
+// и строки вида URL с длинными общими префиксами.
+// state.range(0) - число ключей.
+
+struct Dense
+{
+    static std::vector<uint64_t> keys(size_t n)
+    {
+        std::vector<uint64_t> result(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            result[i] = i;
+        }
+        std::shuffle(result.begin(), result.end(), std::mt19937_64(7));
+        return result;
+    }
+};
+
+struct Sparse
+{
+    static std::vector<uint64_t> keys(size_t n)
+    {
+        std::mt19937_64 rng(7);
+        std::vector<uint64_t> result(n);
+        for (uint64_t &key : result)
+        {
+            key = rng();
+        }
+        return result;
+    }
+};
+
+struct Url
+{
+    static std::vector<std::string> keys(size_t n)
+    {
+        static const char *hosts[] = {"https://www.example.com/", "https://api.example.com/v2/",
+                                      "https://cdn.example.net/static/", "http://docs.example.org/"};
+        std::mt19937_64 rng(7);
+        std::vector<std::string> result(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            result[i] = std::string(hosts[rng() % 4]) + "section" + std::to_string(rng() % 64) +
+                        "/item/" + std::to_string(i);
+        }
+        std::shuffle(result.begin(), result.end(), rng);
+        return result;
+    }
+};
+
+template <typename Map, typename Keys>
+static void BM_Insert(benchmark::State &state)
+{
+    const auto keys = Keys::keys(state.range(0));
+    for (auto _ : state)
+    {
+        Map m;
+        for (const auto &key : keys)
+        {
+            m.insert({key, 1});
+        }
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Map, typename Keys>
+static void BM_Find(benchmark::State &state)
+{
+    auto keys = Keys::keys(state.range(0));
+    Map m;
+    for (const auto &key : keys)
+    {
+        m.insert({key, 1});
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m.find(keys[i])->second);
+        i = i + 1 == keys.size() ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using S21Int = s21::Map<uint64_t, int>;
+using StdInt = std::map<uint64_t, int>;
+using ArtInt = s21::RadixMap<uint64_t, int>;
+using S21Str = s21::Map<std::string, int>;
+using StdStr = std::map<std::string, int>;
+using ArtStr = s21::RadixMap<std::string, int>;
+
+#define RANGES ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond)
+#define FIND_RANGES ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+
+BENCHMARK_TEMPLATE(BM_Insert, S21Int, Dense) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, StdInt, Dense) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, ArtInt, Dense) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, S21Int, Sparse) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, StdInt, Sparse) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, ArtInt, Sparse) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, S21Str, Url) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, StdStr, Url) RANGES;
+BENCHMARK_TEMPLATE(BM_Insert, ArtStr, Url) RANGES;
+
+BENCHMARK_TEMPLATE(BM_Find, S21Int, Dense) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, StdInt, Dense) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, ArtInt, Dense) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, S21Int, Sparse) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, StdInt, Sparse) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, ArtInt, Sparse) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, S21Str, Url) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, StdStr, Url) FIND_RANGES;
+BENCHMARK_TEMPLATE(BM_Find, ArtStr, Url) FIND_RANGES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "../parallel/s21_ring.h"
+#include "../queue/s21_queue.h"
+#include "../vector/s21_vector.h"
+
+// Передача данных между двумя потоками через SpscRing и MpmcRing:
+//   *Throughput - поток-производитель шлёт state.range(1) элементов
+//                 пакетами по state.range(0), главный поток читает;
+//   *PingPong   - время одного круга туда-обратно по двум кольцам.
+// Числа имеют смысл только на машине с двумя и более ядрами.
+// Queue против Vector с erase(begin()) - однопоточная FIFO.
+
+template <typename Ring>
+static void push_all(Ring &ring, size_t n, size_t batch)
+{
+    uint64_t values[256];
+    for (size_t i = 0; i < n;)
+    {
+        size_t count = std::min(batch, n - i);
+        for (size_t k = 0; k < count; ++k)
+        {
+            values[k] = i + k;
+        }
+        size_t pushed = batch == 1 ? ring.try_push(values[0]) : ring.push_batch(values, count);
+        if (pushed == 0)
+        {
+            std::this_thread::yield();
+        }
+        i += pushed;
+    }
+}
+
+template <typename Ring>
+static void BM_Throughput(benchmark::State &state)
+{
+    const size_t batch = state.range(0);
+    const size_t n = state.range(1);
+    Ring ring(1024);
+    for (auto _ : state)
+    {
+        std::thread producer([&]
+                             { push_all(ring, n, batch); });
+        uint64_t values[256];
+        uint64_t sum = 0;
+        for (size_t got = 0; got < n;)
+        {
+            size_t k = batch == 1 ? ring.try_pop(values[0]) : ring.pop_batch(values, batch);
+            if (k == 0)
+            {
+                std::this_thread::yield();
+            }
+            for (size_t j = 0; j < k; ++j)
+            {
+                sum += values[j];
+            }
+            got += k;
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Ring>
+static void BM_PingPong(benchmark::State &state)
+{
+    Ring to(64);
+    Ring back(64);
+    std::atomic<bool> done{false};
+    std::thread echo([&]
+                     {
+        uint64_t value;
+        while (!done.load(std::memory_order_relaxed))
+        {
+            if (!to.try_pop(value))
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                while (!back.try_push(value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        } });
+    uint64_t value = 0;
+    for (auto _ : state)
+    {
+        while (!to.try_push(value))
+        {
+            std::this_thread::yield();
+        }
+        while (!back.try_pop(value))
+        {
+            std::this_thread::yield();
+        }
+        ++value;
+    }
+    done = true;
+    echo.join();
+}
+
+
+static void BM_QueueFifo(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        s21::Queue<uint64_t> queue;
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            queue.push(i);
+        }
+        uint64_t sum = 0;
+        while (!queue.empty())
+        {
+            sum += queue.front();
+            queue.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_VectorEraseFifo(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        s21::Vector<uint64_t> fifo;
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            fifo.push_back(i);
+        }
+        uint64_t sum = 0;
+        while (!fifo.empty())
+        {
+            sum += fifo[0];
+            fifo.erase(fifo.begin());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Throughput, s21::SpscRing<uint64_t>)
+    ->ArgsProduct({{1, 16, 256}, {1 << 20}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, s21::MpmcRing<uint64_t>)
+    ->ArgsProduct({{1, 16, 256}, {1 << 20}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, s21::SpscRing<uint64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, s21::MpmcRing<uint64_t>)->UseRealTime();
+BENCHMARK(BM_QueueFifo)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_VectorEraseFifo)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
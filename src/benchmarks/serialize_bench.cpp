@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+
+#include "../map/s21_map.h"
+#include "../vector/s21_vector.h"
+
+// Сохранение + загрузка через std::stringstream:
+//   Binary     - save()/load(), дерево строится из отсортированных данных
+//   Text       - operator<< / operator>> и insert() на каждый элемент
+//   PerElement - тот же двоичный поток, но загрузка через insert()
+
+static s21::Map<int, int> make_map(int n)
+{
+    s21::Map<int, int> m;
+    for (int i = 0; i < n; ++i)
+    {
+        m.insert({static_cast<int>((i * 2654435761U) % (4U * n)), i});
+    }
+    return m;
+}
+
+static void BM_MapBinary(benchmark::State &state)
+{
+    auto m = make_map(state.range(0));
+    for (auto _ : state)
+    {
+        std::stringstream stream;
+        m.save(stream);
+        s21::Map<int, int> loaded;
+        loaded.load(stream);
+        benchmark::DoNotOptimize(loaded.size());
+    }
+    state.SetItemsProcessed(state.iterations() * m.size());
+}
+
+static void BM_MapText(benchmark::State &state)
+{
+    auto m = make_map(state.range(0));
+    for (auto _ : state)
+    {
+        std::stringstream stream;
+        for (auto it = m.begin(); it != m.end(); ++it)
+        {
+            stream << it->first << ' ' << it->second << '\n';
+        }
+        s21::Map<int, int> loaded;
+        int key;
+        int value;
+        while (stream >> key >> value)
+        {
+            loaded.insert({key, value});
+        }
+        benchmark::DoNotOptimize(loaded.size());
+    }
+    state.SetItemsProcessed(state.iterations() * m.size());
+}
+
+static void BM_MapPerElement(benchmark::State &state)
+{
+    auto m = make_map(state.range(0));
+    for (auto _ : state)
+    {
+        std::stringstream stream;
+        for (auto it = m.begin(); it != m.end(); ++it)
+        {
+            s21::serialize::write_value(stream, it->first);
+            s21::serialize::write_value(stream, it->second);
+        }
+        s21::Map<int, int> loaded;
+        for (size_t i = 0; i < m.size(); ++i)
+        {
+            std::pair<int, int> item;
+            s21::serialize::read_value(stream, item.first);
+            s21::serialize::read_value(stream, item.second);
+            loaded.insert(item);
+        }
+        benchmark::DoNotOptimize(loaded.size());
+    }
+    state.SetItemsProcessed(state.iterations() * m.size());
+}
+
+static void BM_VectorBinary(benchmark::State &state)
+{
+    s21::Vector<double> v(state.range(0));
+    for (auto _ : state)
+    {
+        std::stringstream stream;
+        v.save(stream);
+        s21::Vector<double> loaded;
+        loaded.load(stream);
+        benchmark::DoNotOptimize(loaded.data());
+    }
+    state.SetBytesProcessed(state.iterations() * v.size() * sizeof(double));
+}
+
+static void BM_VectorText(benchmark::State &state)
+{
+    s21::Vector<double> v(state.range(0));
+    for (auto _ : state)
+    {
+        std::stringstream stream;
+        for (double x : v)
+        {
+            stream << x << '\n';
+        }
+        s21::Vector<double> loaded;
+        double x;
+        while (stream >> x)
+        {
+            loaded.push_back(x);
+        }
+        benchmark::DoNotOptimize(loaded.data());
+    }
+    state.SetBytesProcessed(state.iterations() * v.size() * sizeof(double));
+}
+
+// вставка по возрастанию вырождает несбалансированное дерево в список,
+// поэтому per-element и text загружаются только на малых размерах
+BENCHMARK(BM_MapBinary)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapText)->Arg(1 << 10)->Arg(1 << 14)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapPerElement)->Arg(1 << 10)->Arg(1 << 14)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VectorBinary)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VectorText)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
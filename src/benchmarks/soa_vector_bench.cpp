@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "../vector/s21_soa_vector.h"
+#include "../vector/s21_vector.h"
+
+// Проход по одному полю записи: AoS (s21::Vector<Record>) против
+// столбца SoAVector. Запись занимает 64 байта, поле price - 8 из них,
+// поэтому AoS читает из памяти в 8 раз больше данных.
+
+struct Record
+{
+    int64_t id;
+    double price;
+    double weight;
+    int64_t flags;
+    char tag[32];
+};
+
+using Table = s21::SoAVector<int64_t, double, double, int64_t>;
+
+static void BM_AosSum(benchmark::State &state)
+{
+    s21::Vector<Record> records;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        records.push_back(Record{i, i * 0.25, 1.0, 0, {}});
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (const Record &r : records)
+        {
+            sum += r.price;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SoaSum(benchmark::State &state)
+{
+    Table table;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        table.emplace_back(i, i * 0.25, 1.0, 0);
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (double price : table.column<1>())
+        {
+            sum += price;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// два поля: фильтр по flags и сумма weight
+static void BM_AosFilterSum(benchmark::State &state)
+{
+    s21::Vector<Record> records;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        records.push_back(Record{i, 0.0, i * 0.5, i & 1, {}});
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (const Record &r : records)
+        {
+            sum += r.flags ? r.weight : 0.0;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SoaFilterSum(benchmark::State &state)
+{
+    Table table;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        table.emplace_back(i, 0.0, i * 0.5, i & 1);
+    }
+    for (auto _ : state)
+    {
+        s21::Span<const double> weight = std::as_const(table).column<2>();
+        s21::Span<const int64_t> flags = std::as_const(table).column<3>();
+        double sum = 0;
+        for (size_t i = 0; i < weight.size(); ++i)
+        {
+            sum += flags.data()[i] ? weight.data()[i] : 0.0;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_AosSum)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_SoaSum)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_AosFilterSum)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_SoaFilterSum)->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+
+BENCHMARK_MAIN();
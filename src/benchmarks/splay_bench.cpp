@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "../map/s21_map.h"
+
+// Поиск в s21::Map при разных AccessMode. Все деревья стартуют
+// идеально сбалансированными (load() отсортированных данных), так что
+// kStatic - это сбалансированное дерево без перестроек.
+// Ключи запросов - Zipf(0.99) по рангу (ранги перемешаны) или
+// равномерно. state.range(0) - число ключей.
+
+static std::vector<int> make_queries(size_t keys, double s, size_t count)
+{
+    std::mt19937_64 rng(42);
+    std::vector<int> rank_to_key(keys);
+    for (size_t i = 0; i < keys; ++i)
+    {
+        rank_to_key[i] = static_cast<int>(i);
+    }
+    std::shuffle(rank_to_key.begin(), rank_to_key.end(), rng);
+
+    std::vector<int> queries(count);
+    if (s == 0)
+    {
+        std::uniform_int_distribution<size_t> uniform(0, keys - 1);
+        for (int &q : queries)
+        {
+            q = rank_to_key[uniform(rng)];
+        }
+        return queries;
+    }
+    std::vector<double> cdf(keys);
+    double sum = 0;
+    for (size_t i = 0; i < keys; ++i)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+        cdf[i] = sum;
+    }
+    std::uniform_real_distribution<double> uniform(0, sum);
+    for (int &q : queries)
+    {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        q = rank_to_key[std::min(rank, keys - 1)];
+    }
+    return queries;
+}
+
+static void load_balanced(s21::Map<int, int> &m, size_t keys)
+{
+    s21::Map<int, int> sorted;
+    std::vector<int> order(keys);
+    for (size_t i = 0; i < keys; ++i)
+    {
+        order[i] = static_cast<int>(i);
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(7));
+    for (int key : order)
+    {
+        sorted.insert({key, key});
+    }
+    std::stringstream stream;
+    sorted.save(stream);
+    m.load(stream);
+}
+
+template <s21::AccessMode Mode, int ZipfPercent>
+static void BM_Find(benchmark::State &state)
+{
+    const size_t keys = state.range(0);
+    s21::Map<int, int> m;
+    load_balanced(m, keys);
+    m.set_access_mode(Mode);
+    const auto queries = make_queries(keys, ZipfPercent / 100.0, 1 << 20);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m.find(queries[i]));
+        i = (i + 1) & (queries.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["height"] = m.stats().height;
+}
+
+#define RANGES ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+
+BENCHMARK_TEMPLATE(BM_Find, s21::AccessMode::kStatic, 99) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, s21::AccessMode::kSplay, 99) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, s21::AccessMode::kMoveToRoot, 99) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, s21::AccessMode::kStatic, 0) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, s21::AccessMode::kSplay, 0) RANGES;
+BENCHMARK_TEMPLATE(BM_Find, s21::AccessMode::kMoveToRoot, 0) RANGES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,504 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "../set/s21_set.h"
+#include "../vector/s21_vector.h"
+
+// Нагрузочный прогон с проверкой: одна и та же случайная (по seed)
+// последовательность операций выполняется над s21::Map, s21::Set,
+// s21::Vector и их аналогами из std. Результат каждой операции и
+// размер сравниваются сразу, содержимое целиком - периодически.
+// При расхождении печатаются seed и номер шага, код выхода 1.
+// Задержка каждой операции пишется в логарифмическую гистограмму
+// (32 корзины на степень двойки, погрешность до 3%), в отчёте -
+// p50/p90/p99/p99.9/max для s21 и std.
+//
+// Сборка и запуск:
+//   g++ -std=c++17 -O2 -DNDEBUG benchmarks/stress_harness.cpp
+//       -o stress_harness
+//   ./stress_harness --ops=1000000 --keys=100000 --zipf=0.99
+//       --mix=90,8,2 --seed=1 --container=map
+// --mix - доли find, insert, erase в процентах; --zipf=0 - ключи
+// равномерно; --container - map, set, vector или all.
+// Для vector find - чтение по индексу, insert - push_back,
+// erase - удаление из случайной позиции.
+
+struct Options
+{
+    uint64_t ops = 1000000;
+    uint64_t seed = 1;
+    size_t keys = 100000;
+    double zipf = 0.99;
+    unsigned find = 90;
+    unsigned insert = 8;
+    unsigned erase = 2;
+    std::string container = "all";
+};
+
+enum Op
+{
+    kFind,
+    kInsert,
+    kErase,
+    kOpCount
+};
+
+static const char *const kOpNames[kOpCount] = {"find", "insert", "erase"};
+
+// Гистограмма наносекунд: значения меньше 64 хранятся точно,
+// дальше каждая степень двойки делится на 32 корзины.
+class LatencyHistogram
+{
+public:
+    static constexpr size_t kSubBuckets = 32;
+    static constexpr size_t kLinear = 2 * kSubBuckets;
+    static constexpr size_t kBuckets = kLinear + (64 - 6) * kSubBuckets;
+
+    LatencyHistogram() : buckets_(kBuckets) {}
+
+    void add(uint64_t ns)
+    {
+        ++buckets_[index_of(ns)];
+        ++count_;
+        max_ = std::max(max_, ns);
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t max() const { return max_; }
+
+    // нижняя граница корзины, в которой лежит квантиль q
+    uint64_t percentile(double q) const
+    {
+        if (!count_)
+        {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(std::ceil(q * count_));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; ++i)
+        {
+            seen += buckets_[i];
+            if (seen >= rank && buckets_[i])
+            {
+                return lower_bound_of(i);
+            }
+        }
+        return max_;
+    }
+
+private:
+    static size_t index_of(uint64_t v)
+    {
+        if (v < kLinear)
+        {
+            return v;
+        }
+        size_t e = 63 - __builtin_clzll(v);
+        return kLinear + (e - 6) * kSubBuckets + ((v >> (e - 5)) & (kSubBuckets - 1));
+    }
+
+    static uint64_t lower_bound_of(size_t i)
+    {
+        if (i < kLinear)
+        {
+            return i;
+        }
+        size_t e = (i - kLinear) / kSubBuckets + 6;
+        uint64_t m = (i - kLinear) % kSubBuckets;
+        return (kSubBuckets + m) << (e - 5);
+    }
+
+    std::vector<uint64_t> buckets_;
+    uint64_t count_ = 0;
+    uint64_t max_ = 0;
+};
+
+// Ключи 0..keys-1 с распределением Zipf(s) по рангу; ранги
+// перемешаны, чтобы горячие ключи не оказались подряд.
+class KeySource
+{
+public:
+    KeySource(size_t keys, double s, std::mt19937_64 &rng)
+        : rng_(rng), uniform_(0, keys - 1), rank_to_key_(keys)
+    {
+        for (size_t i = 0; i < keys; ++i)
+        {
+            rank_to_key_[i] = static_cast<int>(i);
+        }
+        std::shuffle(rank_to_key_.begin(), rank_to_key_.end(), rng_);
+        if (s > 0)
+        {
+            cdf_.resize(keys);
+            double sum = 0;
+            for (size_t i = 0; i < keys; ++i)
+            {
+                sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+                cdf_[i] = sum;
+            }
+            for (double &c : cdf_)
+            {
+                c /= sum;
+            }
+        }
+    }
+
+    int next()
+    {
+        if (cdf_.empty())
+        {
+            return rank_to_key_[uniform_(rng_)];
+        }
+        double u = std::uniform_real_distribution<double>(0, 1)(rng_);
+        size_t rank = std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+        return rank_to_key_[std::min(rank, cdf_.size() - 1)];
+    }
+
+private:
+    std::mt19937_64 &rng_;
+    std::uniform_int_distribution<size_t> uniform_;
+    std::vector<int> rank_to_key_;
+    std::vector<double> cdf_;
+};
+
+struct Report
+{
+    LatencyHistogram s21[kOpCount];
+    LatencyHistogram std[kOpCount];
+};
+
+static uint64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// замер одного вызова f, результат f возвращается
+template <typename F>
+static auto timed(LatencyHistogram &h, F f)
+{
+    uint64_t start = now_ns();
+    auto result = f();
+    h.add(now_ns() - start);
+    return result;
+}
+
+[[noreturn]] static void mismatch(const char *container, const Options &opt,
+                                  uint64_t step, const char *what)
+{
+    std::fprintf(stderr, "%s: mismatch at step %llu (seed %llu): %s\n", container,
+                 static_cast<unsigned long long>(step),
+                 static_cast<unsigned long long>(opt.seed), what);
+    std::exit(1);
+}
+
+static Op pick_op(const Options &opt, std::mt19937_64 &rng)
+{
+    unsigned roll = std::uniform_int_distribution<unsigned>(0, 99)(rng);
+    if (roll < opt.find)
+    {
+        return kFind;
+    }
+    return roll < opt.find + opt.insert ? kInsert : kErase;
+}
+
+// Map и Set различаются только видом элемента
+template <typename S21, typename Std, bool kIsMap>
+static void run_tree(const char *name, const Options &opt, Report &report)
+{
+    std::mt19937_64 rng(opt.seed);
+    KeySource source(opt.keys, opt.zipf, rng);
+    S21 a;
+    Std b;
+
+    auto element = [](int key, int value) {
+        if constexpr (kIsMap)
+        {
+            return std::pair<const int, int>(key, value);
+        }
+        else
+        {
+            (void)value;
+            return key;
+        }
+    };
+    auto same_contents = [&]() {
+        auto it = a.begin();
+        for (const auto &item : b)
+        {
+            if constexpr (kIsMap)
+            {
+                if (it == a.end() || it->first != item.first || it->second != item.second)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if (it == a.end() || it->first != item)
+                {
+                    return false;
+                }
+            }
+            ++it;
+        }
+        return it == a.end();
+    };
+
+    // половина ключей в случайном порядке, чтобы дерево s21 не выродилось
+    std::vector<int> prefill(opt.keys);
+    for (size_t i = 0; i < opt.keys; ++i)
+    {
+        prefill[i] = static_cast<int>(i);
+    }
+    std::shuffle(prefill.begin(), prefill.end(), rng);
+    prefill.resize(opt.keys / 2);
+    for (int key : prefill)
+    {
+        a.insert(element(key, key));
+        b.insert(element(key, key));
+    }
+
+    for (uint64_t step = 0; step < opt.ops; ++step)
+    {
+        Op op = pick_op(opt, rng);
+        int key = source.next();
+        int value = static_cast<int>(step);
+        if (op == kFind)
+        {
+            auto got = timed(report.s21[kFind], [&]() {
+                auto it = a.find(key);
+                if constexpr (kIsMap)
+                {
+                    return it == a.end() ? -1 : it->second;
+                }
+                else
+                {
+                    return it == a.end() ? -1 : it->first;
+                }
+            });
+            auto want = timed(report.std[kFind], [&]() {
+                auto it = b.find(key);
+                if constexpr (kIsMap)
+                {
+                    return it == b.end() ? -1 : it->second;
+                }
+                else
+                {
+                    return it == b.end() ? -1 : *it;
+                }
+            });
+            if (got != want)
+            {
+                mismatch(name, opt, step, "find");
+            }
+        }
+        else if (op == kInsert)
+        {
+            bool got = timed(report.s21[kInsert], [&]() { return a.insert(element(key, value)).second; });
+            bool want = timed(report.std[kInsert], [&]() { return b.insert(element(key, value)).second; });
+            if (got != want)
+            {
+                mismatch(name, opt, step, "insert");
+            }
+        }
+        else
+        {
+            bool got = timed(report.s21[kErase], [&]() {
+                auto it = a.find(key);
+                if (it == a.end())
+                {
+                    return false;
+                }
+                a.erase(it);
+                return true;
+            });
+            bool want = timed(report.std[kErase], [&]() { return b.erase(key) == 1; });
+            if (got != want)
+            {
+                mismatch(name, opt, step, "erase");
+            }
+        }
+        if (a.size() != b.size())
+        {
+            mismatch(name, opt, step, "size");
+        }
+        if ((step & 0xffff) == 0xffff && !same_contents())
+        {
+            mismatch(name, opt, step, "contents");
+        }
+    }
+    if (!same_contents())
+    {
+        mismatch(name, opt, opt.ops, "contents");
+    }
+}
+
+static void run_vector(const Options &opt, Report &report)
+{
+    std::mt19937_64 rng(opt.seed);
+    s21::Vector<int> a;
+    std::vector<int> b;
+    for (size_t i = 0; i < opt.keys / 2; ++i)
+    {
+        a.push_back(static_cast<int>(i));
+        b.push_back(static_cast<int>(i));
+    }
+    for (uint64_t step = 0; step < opt.ops; ++step)
+    {
+        Op op = pick_op(opt, rng);
+        int value = static_cast<int>(step);
+        if (op == kInsert || b.empty())
+        {
+            timed(report.s21[kInsert], [&]() { a.push_back(value); return 0; });
+            timed(report.std[kInsert], [&]() { b.push_back(value); return 0; });
+        }
+        else
+        {
+            size_t pos = std::uniform_int_distribution<size_t>(0, b.size() - 1)(rng);
+            if (op == kFind)
+            {
+                int got = timed(report.s21[kFind], [&]() { return a.at(pos); });
+                int want = timed(report.std[kFind], [&]() { return b.at(pos); });
+                if (got != want)
+                {
+                    mismatch("vector", opt, step, "read");
+                }
+            }
+            else
+            {
+                timed(report.s21[kErase], [&]() { a.erase(a.begin() + pos); return 0; });
+                timed(report.std[kErase], [&]() { b.erase(b.begin() + pos); return 0; });
+            }
+        }
+        if (a.size() != b.size())
+        {
+            mismatch("vector", opt, step, "size");
+        }
+        if ((step & 0xffff) == 0xffff && !std::equal(b.begin(), b.end(), a.begin()))
+        {
+            mismatch("vector", opt, step, "contents");
+        }
+    }
+    if (!std::equal(b.begin(), b.end(), a.begin()))
+    {
+        mismatch("vector", opt, opt.ops, "contents");
+    }
+}
+
+static void print_report(const char *name, const Report &report)
+{
+    std::printf("%-8s %-7s %-4s %10s %8s %8s %8s %8s %10s\n", name, "op", "impl",
+                "count", "p50", "p90", "p99", "p99.9", "max");
+    for (int op = 0; op < kOpCount; ++op)
+    {
+        const LatencyHistogram *rows[2] = {&report.s21[op], &report.std[op]};
+        const char *impl[2] = {"s21", "std"};
+        for (int i = 0; i < 2; ++i)
+        {
+            const LatencyHistogram &h = *rows[i];
+            std::printf("%-8s %-7s %-4s %10llu %8llu %8llu %8llu %8llu %10llu\n", "",
+                        kOpNames[op], impl[i], static_cast<unsigned long long>(h.count()),
+                        static_cast<unsigned long long>(h.percentile(0.5)),
+                        static_cast<unsigned long long>(h.percentile(0.9)),
+                        static_cast<unsigned long long>(h.percentile(0.99)),
+                        static_cast<unsigned long long>(h.percentile(0.999)),
+                        static_cast<unsigned long long>(h.max()));
+        }
+    }
+}
+
+static bool parse(int argc, char **argv, Options &opt)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        const char *eq = std::strchr(arg, '=');
+        if (std::strncmp(arg, "--", 2) != 0 || !eq)
+        {
+            return false;
+        }
+        std::string name(arg + 2, eq);
+        const char *value = eq + 1;
+        if (name == "ops")
+        {
+            opt.ops = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "seed")
+        {
+            opt.seed = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "keys")
+        {
+            opt.keys = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "zipf")
+        {
+            opt.zipf = std::strtod(value, nullptr);
+        }
+        else if (name == "mix")
+        {
+            if (std::sscanf(value, "%u,%u,%u", &opt.find, &opt.insert, &opt.erase) != 3)
+            {
+                return false;
+            }
+        }
+        else if (name == "container")
+        {
+            opt.container = value;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return opt.keys >= 2 && opt.find + opt.insert + opt.erase == 100;
+}
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    if (!parse(argc, argv, opt))
+    {
+        std::fprintf(stderr,
+                     "usage: %s [--ops=N] [--keys=N] [--zipf=S] [--mix=FIND,INSERT,ERASE]"
+                     " [--seed=N] [--container=map|set|vector|all]\n"
+                     "mix percentages must add up to 100\n",
+                     argv[0]);
+        return 2;
+    }
+    std::printf("ops=%llu keys=%zu zipf=%g mix=%u/%u/%u seed=%llu, latency in ns\n",
+                static_cast<unsigned long long>(opt.ops), opt.keys, opt.zipf, opt.find,
+                opt.insert, opt.erase, static_cast<unsigned long long>(opt.seed));
+    bool all = opt.container == "all";
+    if (all || opt.container == "map")
+    {
+        Report report;
+        run_tree<s21::Map<int, int>, std::map<int, int>, true>("map", opt, report);
+        print_report("map", report);
+    }
+    if (all || opt.container == "set")
+    {
+        Report report;
+        run_tree<s21::Set<int>, std::set<int>, false>("set", opt, report);
+        print_report("set", report);
+    }
+    if (all || opt.container == "vector")
+    {
+        Report report;
+        run_vector(opt, report);
+        print_report("vector", report);
+    }
+    return 0;
+}
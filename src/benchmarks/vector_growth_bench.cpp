@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+
+// Рост вектора до state.range(0) МБ через push_back для каждой политики.
+// Пиковый RSS (VmHWM) сбрасывается перед каждым прогоном через
+// /proc/self/clear_refs, поэтому счётчик относится к одному росту.
+
+static void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+static double peak_rss_mb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind("VmHWM:", 0) == 0)
+        {
+            return std::stod(line.substr(6)) / 1024.0;
+        }
+    }
+    return 0.0;
+}
+
+template <typename Vec>
+static void BM_GrowTo(benchmark::State &state)
+{
+    const size_t n = (size_t(state.range(0)) << 20) / sizeof(uint64_t);
+    double peak = 0.0;
+    double capacity = 0.0;
+    for (auto _ : state)
+    {
+        reset_peak_rss();
+        Vec v;
+        for (size_t i = 0; i < n; ++i)
+        {
+            v.push_back(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+        peak = peak_rss_mb();
+        capacity = v.capacity() * sizeof(uint64_t) / double(1 << 20);
+    }
+    state.counters["peak_rss_MB"] = peak;
+    state.counters["capacity_MB"] = capacity;
+}
+
+#define GROWTH_ARGS Arg(64)->Arg(512)->Arg(4096)->Unit(benchmark::kMillisecond)->Iterations(1)
+
+BENCHMARK(BM_GrowTo<s21::Vector<uint64_t>>)->GROWTH_ARGS;
+BENCHMARK(BM_GrowTo<s21::Vector<uint64_t, s21::GrowHalf>>)->GROWTH_ARGS;
+BENCHMARK(BM_GrowTo<s21::Vector<uint64_t, s21::GrowChunk<(size_t(64) << 20) / sizeof(uint64_t)>>>)->GROWTH_ARGS;
+BENCHMARK(BM_GrowTo<std::vector<uint64_t>>)->GROWTH_ARGS;
+
+BENCHMARK_MAIN();
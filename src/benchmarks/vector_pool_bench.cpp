@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include "../vector/s21_vector.h"
+
+// Цикл создать/заполнить/уничтожить для короткоживущих векторов
+// с потоковым пулом буферов и без него.
+
+template <typename Memory>
+static void BM_CreateFillDestroy(benchmark::State &state)
+{
+    const int n = static_cast<int>(state.range(0));
+    auto &pool = s21::vector_memory::BufferPool::local();
+    pool.trim();
+    pool.reset_stats();
+    for (auto _ : state)
+    {
+        s21::Vector<int, s21::GrowDouble, Memory> v;
+        v.reserve(n);
+        for (int i = 0; i < n; ++i)
+        {
+            v.push_back(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    auto stats = pool.stats();
+    state.counters["pool_hits"] = stats.hits;
+    state.counters["pool_misses"] = stats.misses;
+}
+
+BENCHMARK(BM_CreateFillDestroy<s21::HeapMemory>)->RangeMultiplier(4)->Range(16, 16384);
+BENCHMARK(BM_CreateFillDestroy<s21::PooledMemory>)->RangeMultiplier(4)->Range(16, 16384);
+
+BENCHMARK_MAIN();
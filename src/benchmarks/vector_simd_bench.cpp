@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "../vector/s21_vector_simd.h"
+
+// Пропускная способность simd-алгоритмов (bytes_per_second) на каждом
+// уровне диспетчеризации: 0 - скаляр, 1 - SSE4.1, 2 - AVX2.
+
+template <typename T>
+static s21::Vector<T> make_data(size_t n)
+{
+    s21::Vector<T> v(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        v[i] = static_cast<T>((i * 2654435761U) % 1000);
+    }
+    return v;
+}
+
+template <typename T, typename Op>
+static void run(benchmark::State &state, Op op, int passes = 1)
+{
+    s21::simd::force(static_cast<s21::simd::Level>(state.range(1)));
+    auto v = make_data<T>(state.range(0));
+    auto w = make_data<T>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(op(v, w));
+    }
+    state.SetBytesProcessed(state.iterations() * passes * v.size() * sizeof(T));
+    s21::simd::force(s21::simd::detect());
+}
+
+template <typename T>
+static void BM_Find(benchmark::State &state)
+{
+    run<T>(state, [](auto &v, auto &) { return s21::find(v, T(-1)); });
+}
+
+template <typename T>
+static void BM_Count(benchmark::State &state)
+{
+    run<T>(state, [](auto &v, auto &) { return s21::count(v, T(7)); });
+}
+
+template <typename T>
+static void BM_Sum(benchmark::State &state)
+{
+    run<T>(state, [](auto &v, auto &) { return s21::sum(v); });
+}
+
+template <typename T>
+static void BM_MinMax(benchmark::State &state)
+{
+    run<T>(state, [](auto &v, auto &) { return s21::min_max(v); });
+}
+
+template <typename T>
+static void BM_Equal(benchmark::State &state)
+{
+    run<T>(state, [](auto &v, auto &w) { return s21::equal(v, w); }, 2);
+}
+
+#define SIMD_ARGS ArgsProduct({{1 << 12, 1 << 22}, {0, 1, 2}})
+
+BENCHMARK(BM_Find<int32_t>)->SIMD_ARGS;
+BENCHMARK(BM_Find<float>)->SIMD_ARGS;
+BENCHMARK(BM_Count<int32_t>)->SIMD_ARGS;
+BENCHMARK(BM_Count<float>)->SIMD_ARGS;
+BENCHMARK(BM_Sum<int32_t>)->SIMD_ARGS;
+BENCHMARK(BM_Sum<float>)->SIMD_ARGS;
+BENCHMARK(BM_MinMax<int32_t>)->SIMD_ARGS;
+BENCHMARK(BM_MinMax<float>)->SIMD_ARGS;
+BENCHMARK(BM_Equal<int32_t>)->SIMD_ARGS;
+BENCHMARK(BM_Equal<float>)->SIMD_ARGS;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,517 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_config.h"
+
+namespace s21
+{
+    namespace deque_detail
+    {
+        // число элементов в блоке: степень двойки, блок около 4 КиБ,
+        // но не меньше 16 элементов
+        template <typename T>
+        constexpr size_t block_size()
+        {
+            size_t n = sizeof(T) < 4096 / 16 ? 4096 / sizeof(T) : 16;
+            size_t p = 1;
+            while (p * 2 <= n)
+            {
+                p *= 2;
+            }
+            return p;
+        }
+
+        template <typename T>
+        constexpr size_t block_shift()
+        {
+            size_t s = 0;
+            while ((size_t(1) << s) < block_size<T>())
+            {
+                ++s;
+            }
+            return s;
+        }
+
+        // Итератор по блокам: внутри блока - обычный указатель,
+        // на границе переходит к следующему блоку через карту
+        template <typename T, bool Const>
+        class Iterator
+        {
+            using Elem = std::conditional_t<Const, const T, T>;
+            static constexpr ptrdiff_t kBlock = block_size<T>();
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = ptrdiff_t;
+            using pointer = Elem *;
+            using reference = Elem &;
+
+            Iterator() = default;
+            Iterator(T *cur, T **node) : cur_(cur), first_(node ? *node : nullptr), node_(node) {}
+            template <bool C = Const, typename = std::enable_if_t<C>>
+            Iterator(const Iterator<T, false> &other)
+                : cur_(other.cur_), first_(other.first_), node_(other.node_) {}
+
+            reference operator*() const { return *cur_; }
+            pointer operator->() const { return cur_; }
+            reference operator[](difference_type n) const { return *(*this + n); }
+
+            Iterator &operator++()
+            {
+                if (++cur_ == first_ + kBlock)
+                {
+                    set_node_(node_ + 1);
+                    cur_ = first_;
+                }
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            Iterator &operator--()
+            {
+                if (cur_ == first_)
+                {
+                    set_node_(node_ - 1);
+                    cur_ = first_ + kBlock;
+                }
+                --cur_;
+                return *this;
+            }
+            Iterator operator--(int)
+            {
+                Iterator tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            Iterator &operator+=(difference_type n)
+            {
+                difference_type offset = n + (cur_ - first_);
+                if (offset >= 0 && offset < kBlock)
+                {
+                    cur_ += n;
+                }
+                else
+                {
+                    difference_type node_offset =
+                        offset > 0 ? offset / kBlock : -((-offset - 1) / kBlock) - 1;
+                    set_node_(node_ + node_offset);
+                    cur_ = first_ + (offset - node_offset * kBlock);
+                }
+                return *this;
+            }
+            Iterator &operator-=(difference_type n) { return *this += -n; }
+            friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+            friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+            friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+
+            friend difference_type operator-(const Iterator &a, const Iterator &b)
+            {
+                return (a.node_ - b.node_) * kBlock + (a.cur_ - a.first_) -
+                       (b.cur_ - b.first_);
+            }
+            friend bool operator==(const Iterator &a, const Iterator &b) { return a.cur_ == b.cur_; }
+            friend bool operator!=(const Iterator &a, const Iterator &b) { return a.cur_ != b.cur_; }
+            friend bool operator<(const Iterator &a, const Iterator &b) { return a - b < 0; }
+            friend bool operator>(const Iterator &a, const Iterator &b) { return b < a; }
+            friend bool operator<=(const Iterator &a, const Iterator &b) { return !(b < a); }
+            friend bool operator>=(const Iterator &a, const Iterator &b) { return !(a < b); }
+
+        private:
+            template <typename, bool>
+            friend class Iterator;
+
+            void set_node_(T **node)
+            {
+                node_ = node;
+                first_ = *node;
+            }
+
+            T *cur_ = nullptr;
+            T *first_ = nullptr;
+            T **node_ = nullptr;
+        };
+    }
+
+    // Двусторонняя очередь из блоков фиксированного размера.
+    // Элементы никогда не перемещаются: при росте перевыделяется только
+    // карта указателей на блоки, поэтому адреса и ссылки на элементы
+    // остаются действительными при push_back/push_front. Освободившиеся
+    // блоки остаются в карте и переиспользуются.
+    //
+    // Инвариант: если карта выделена, блоки с позициями
+    // [start_, start_ + size_] (включая позицию end()) выделены.
+    template <typename T>
+    class Deque
+    {
+    public:
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+        using iterator = deque_detail::Iterator<T, false>;
+        using const_iterator = deque_detail::Iterator<T, true>;
+
+        static constexpr size_type kBlockSize = deque_detail::block_size<T>();
+
+        Deque() = default;
+        explicit Deque(size_type n);
+        Deque(std::initializer_list<value_type> const &items);
+        Deque(const Deque &other);
+        Deque(Deque &&other) noexcept;
+        Deque &operator=(const Deque &other);
+        Deque &operator=(Deque &&other) noexcept;
+        ~Deque();
+
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        reference front() { return (*this)[0]; }
+        const_reference front() const { return (*this)[0]; }
+        reference back() { return (*this)[size_ - 1]; }
+        const_reference back() const { return (*this)[size_ - 1]; }
+
+        iterator begin() { return make_iterator_(start_); }
+        iterator end() { return make_iterator_(start_ + size_); }
+        const_iterator begin() const { return make_iterator_(start_); }
+        const_iterator end() const { return make_iterator_(start_ + size_); }
+
+        bool empty() const { return size_ == 0; }
+        size_type size() const { return size_; }
+        size_type max_size() const;
+
+        void clear();
+        // освободить блоки вне занятого диапазона
+        void shrink_to_fit();
+        void push_back(const_reference value) { emplace_back(value); }
+        void push_back(value_type &&value) { emplace_back(std::move(value)); }
+        void push_front(const_reference value) { emplace_front(value); }
+        void push_front(value_type &&value) { emplace_front(std::move(value)); }
+        template <typename... Args>
+        reference emplace_back(Args &&...args);
+        template <typename... Args>
+        reference emplace_front(Args &&...args);
+        void pop_back();
+        void pop_front();
+        void swap(Deque &other) noexcept;
+
+    private:
+        static constexpr size_type kShift = deque_detail::block_shift<T>();
+        static constexpr size_type kMask = kBlockSize - 1;
+        static constexpr size_type kInitialMap = 8;
+
+        T *slot_(size_type pos) const { return map_[pos >> kShift] + (pos & kMask); }
+        iterator make_iterator_(size_type pos) const
+        {
+            return map_ ? iterator(slot_(pos), map_ + (pos >> kShift)) : iterator();
+        }
+        T *block_(size_type node);
+        void reallocate_map_(bool at_front);
+        void destroy_all_();
+
+        T **map_ = nullptr;
+        size_type map_size_ = 0;
+        size_type start_ = 0;
+        size_type size_ = 0;
+    };
+
+    template <typename T>
+    Deque<T>::Deque(size_type n) : Deque()
+    {
+        for (size_type i = 0; i < n; ++i)
+        {
+            emplace_back();
+        }
+    }
+
+    template <typename T>
+    Deque<T>::Deque(std::initializer_list<value_type> const &items) : Deque()
+    {
+        for (const_reference item : items)
+        {
+            push_back(item);
+        }
+    }
+
+    template <typename T>
+    Deque<T>::Deque(const Deque &other) : Deque()
+    {
+        for (const_reference item : other)
+        {
+            push_back(item);
+        }
+    }
+
+    template <typename T>
+    Deque<T>::Deque(Deque &&other) noexcept
+    {
+        swap(other);
+    }
+
+    template <typename T>
+    Deque<T> &Deque<T>::operator=(const Deque &other)
+    {
+        if (this != &other)
+        {
+            Deque tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    Deque<T> &Deque<T>::operator=(Deque &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Deque tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    Deque<T>::~Deque()
+    {
+        destroy_all_();
+    }
+
+    template <typename T>
+    typename Deque<T>::reference Deque<T>::at(size_type pos)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return *slot_(start_ + pos);
+    }
+
+    template <typename T>
+    typename Deque<T>::const_reference Deque<T>::at(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return *slot_(start_ + pos);
+    }
+
+    template <typename T>
+    typename Deque<T>::reference Deque<T>::operator[](size_type pos)
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return *slot_(start_ + pos);
+    }
+
+    template <typename T>
+    typename Deque<T>::const_reference Deque<T>::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return *slot_(start_ + pos);
+    }
+
+    template <typename T>
+    typename Deque<T>::size_type Deque<T>::max_size() const
+    {
+        return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+    }
+
+    template <typename T>
+    void Deque<T>::clear()
+    {
+        while (size_)
+        {
+            pop_back();
+        }
+    }
+
+    template <typename T>
+    void Deque<T>::shrink_to_fit()
+    {
+        if (!map_)
+        {
+            return;
+        }
+        size_type first = start_ >> kShift;
+        size_type last = (start_ + size_) >> kShift;
+        std::allocator<T> alloc;
+        for (size_type i = 0; i < map_size_; ++i)
+        {
+            if (map_[i] && (i < first || i > last))
+            {
+                alloc.deallocate(map_[i], kBlockSize);
+                map_[i] = nullptr;
+            }
+        }
+    }
+
+    // перед записью элемента на последнее место блока готовится
+    // блок для позиции end(), чтобы исключение не оставило элемент
+    // без учёта в size_
+    template <typename T>
+    template <typename... Args>
+    typename Deque<T>::reference Deque<T>::emplace_back(Args &&...args)
+    {
+        if (!map_)
+        {
+            reallocate_map_(false);
+        }
+        size_type pos = start_ + size_;
+        if (((pos + 1) & kMask) == 0)
+        {
+            if (((pos + 1) >> kShift) == map_size_)
+            {
+                reallocate_map_(false);
+                pos = start_ + size_;
+            }
+            block_((pos + 1) >> kShift);
+        }
+        T *p = slot_(pos);
+        ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    typename Deque<T>::reference Deque<T>::emplace_front(Args &&...args)
+    {
+        if (!map_ || start_ == 0)
+        {
+            reallocate_map_(true);
+        }
+        size_type pos = start_ - 1;
+        T *p = block_(pos >> kShift) + (pos & kMask);
+        ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+        start_ = pos;
+        ++size_;
+        return *p;
+    }
+
+    template <typename T>
+    void Deque<T>::pop_back()
+    {
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Deque is empty");
+        }
+        --size_;
+        std::destroy_at(slot_(start_ + size_));
+    }
+
+    template <typename T>
+    void Deque<T>::pop_front()
+    {
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Deque is empty");
+        }
+        std::destroy_at(slot_(start_));
+        ++start_;
+        --size_;
+    }
+
+    template <typename T>
+    void Deque<T>::swap(Deque &other) noexcept
+    {
+        std::swap(map_, other.map_);
+        std::swap(map_size_, other.map_size_);
+        std::swap(start_, other.start_);
+        std::swap(size_, other.size_);
+    }
+
+    template <typename T>
+    T *Deque<T>::block_(size_type node)
+    {
+        if (!map_[node])
+        {
+            map_[node] = std::allocator<T>().allocate(kBlockSize);
+        }
+        return map_[node];
+    }
+
+    // Новая карта вдвое больше занятой части; занятые блоки ставятся
+    // в середину, чтобы запас был с обеих сторон. Запасные блоки
+    // переносятся в свободные ячейки со стороны роста.
+    template <typename T>
+    void Deque<T>::reallocate_map_(bool at_front)
+    {
+        size_type first = start_ >> kShift;
+        size_type used = map_ ? ((start_ + size_) >> kShift) - first + 1 : 1;
+        size_type new_size = std::max(kInitialMap, 2 * used + 2);
+        size_type new_first = (new_size - used) / 2;
+
+        T **new_map = new T *[new_size]();
+        if (map_)
+        {
+            std::copy(map_ + first, map_ + first + used, new_map + new_first);
+            size_type spare_slot = at_front ? new_first : new_first + used;
+            for (size_type i = 0; i < map_size_; ++i)
+            {
+                if (map_[i] && (i < first || i >= first + used))
+                {
+                    if (at_front && spare_slot > 0)
+                    {
+                        new_map[--spare_slot] = map_[i];
+                    }
+                    else if (!at_front && spare_slot < new_size)
+                    {
+                        new_map[spare_slot++] = map_[i];
+                    }
+                    else
+                    {
+                        std::allocator<T>().deallocate(map_[i], kBlockSize);
+                    }
+                }
+            }
+            delete[] map_;
+        }
+        else
+        {
+            new_map[new_first] = std::allocator<T>().allocate(kBlockSize);
+        }
+        start_ = (new_first << kShift) + (start_ & kMask);
+        map_ = new_map;
+        map_size_ = new_size;
+    }
+
+    template <typename T>
+    void Deque<T>::destroy_all_()
+    {
+        if (!map_)
+        {
+            return;
+        }
+        clear();
+        std::allocator<T> alloc;
+        for (size_type i = 0; i < map_size_; ++i)
+        {
+            if (map_[i])
+            {
+                alloc.deallocate(map_[i], kBlockSize);
+            }
+        }
+        delete[] map_;
+        map_ = nullptr;
+        map_size_ = 0;
+        start_ = 0;
+    }
+}
+
+#endif // S21_DEQUE_H
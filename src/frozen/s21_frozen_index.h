@@ -0,0 +1,210 @@
+#ifndef S21_FROZEN_INDEX_H
+#define S21_FROZEN_INDEX_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21
+{
+    // Неизменяемый индекс для поиска в отсортированных уникальных
+    // данных (Map::freeze, Set::freeze). Элементы лежат в одном
+    // непрерывном массиве в порядке Эйтцингера (обход дерева в
+    // ширину): корень в ячейке 1, потомки ячейки k - в 2k и 2k + 1,
+    // ячейка 0 не используется. Спуск идёт без ветвлений по
+    // результату сравнения, а блок потомков на несколько уровней
+    // вниз заранее подгружается в кэш. Отсортированный обход
+    // восстанавливается арифметикой над номерами ячеек.
+    //
+    // V = void - индекс множества, элемент - сам ключ.
+    template <typename K, typename V = void>
+    class FrozenIndex
+    {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::conditional_t<std::is_void_v<V>, K, std::pair<K, V>>;
+        using const_reference = const value_type &;
+        using size_type = size_t;
+
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = FrozenIndex::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type *;
+            using reference = const value_type &;
+
+            const_iterator() = default;
+
+            const_reference operator*() const { return index_->slots_[pos_]; }
+            const value_type *operator->() const { return &index_->slots_[pos_]; }
+
+            const_iterator &operator++()
+            {
+                pos_ = index_->next_(pos_);
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            bool operator==(const const_iterator &other) const { return pos_ == other.pos_; }
+            bool operator!=(const const_iterator &other) const { return pos_ != other.pos_; }
+
+        private:
+            friend class FrozenIndex;
+            const_iterator(const FrozenIndex *index, size_type pos) : index_(index), pos_(pos) {}
+
+            const FrozenIndex *index_ = nullptr;
+            // номер ячейки, 0 - end()
+            size_type pos_ = 0;
+        };
+
+        FrozenIndex() = default;
+        // sorted - строго возрастающие по ключу элементы
+        explicit FrozenIndex(const std::vector<value_type> &sorted);
+
+        bool empty() const noexcept { return size() == 0; }
+        size_type size() const noexcept { return slots_.empty() ? 0 : slots_.size() - 1; }
+
+        const_iterator begin() const { return const_iterator(this, first_); }
+        const_iterator end() const { return const_iterator(this, 0); }
+
+        // первый элемент с ключом не меньше key
+        const_iterator lower_bound(const key_type &key) const
+        {
+            return const_iterator(this, lower_bound_pos_(key));
+        }
+        const_iterator find(const key_type &key) const
+        {
+            size_type pos = lower_bound_pos_(key);
+            return const_iterator(this, pos != 0 && !(key < key_of(slots_[pos])) ? pos : 0);
+        }
+        bool contains(const key_type &key) const { return find(key) != end(); }
+
+        template <typename U = V, typename = std::enable_if_t<!std::is_void_v<U>>>
+        const U &at(const key_type &key) const
+        {
+            const_iterator it = find(key);
+            if (it == end())
+            {
+                throw std::out_of_range("Key not found in frozen index");
+            }
+            return it->second;
+        }
+
+    private:
+        static const key_type &key_of(const value_type &value)
+        {
+            if constexpr (std::is_void_v<V>)
+            {
+                return value;
+            }
+            else
+            {
+                return value.first;
+            }
+        }
+
+        // столько соседних ячеек помещается в строку кэша (степень
+        // двойки): с ячейки k * stride начинаются потомки k на
+        // log2(stride) уровней ниже
+        static constexpr size_type prefetch_stride_()
+        {
+            size_type stride = 2;
+            while (stride * 2 * sizeof(value_type) <= 64)
+            {
+                stride *= 2;
+            }
+            return stride;
+        }
+
+        void fill_(std::vector<value_type> const &sorted, size_type &next, size_type pos);
+        size_type lower_bound_pos_(const key_type &key) const;
+        size_type next_(size_type pos) const;
+
+        std::vector<value_type> slots_;
+        // ячейка наименьшего элемента
+        size_type first_ = 0;
+    };
+
+    template <typename K, typename V>
+    FrozenIndex<K, V>::FrozenIndex(const std::vector<value_type> &sorted)
+    {
+        if (sorted.empty())
+        {
+            return;
+        }
+        slots_.resize(sorted.size() + 1, sorted.front());
+        size_type next = 0;
+        fill_(sorted, next, 1);
+        first_ = 1;
+        while (first_ * 2 < slots_.size())
+        {
+            first_ *= 2;
+        }
+    }
+
+    // симметричный обход раскладывает отсортированные элементы по
+    // ячейкам; глубина рекурсии - log2(n)
+    template <typename K, typename V>
+    void FrozenIndex<K, V>::fill_(std::vector<value_type> const &sorted, size_type &next,
+                                  size_type pos)
+    {
+        if (pos >= slots_.size())
+        {
+            return;
+        }
+        fill_(sorted, next, 2 * pos);
+        slots_[pos] = sorted[next++];
+        fill_(sorted, next, 2 * pos + 1);
+    }
+
+    // Спуск: k = 2k + (slot < key). После выхода за массив путь
+    // в двоичной записи k, последний поворот налево указывает на
+    // ответ: отбрасываем хвост единиц (повороты направо) и ещё один бит.
+    template <typename K, typename V>
+    typename FrozenIndex<K, V>::size_type
+    FrozenIndex<K, V>::lower_bound_pos_(const key_type &key) const
+    {
+        const size_type n = slots_.size();
+        const value_type *slots = slots_.data();
+        size_type k = 1;
+        while (k < n)
+        {
+            __builtin_prefetch(slots + k * prefetch_stride_());
+            k = 2 * k + static_cast<size_type>(key_of(slots[k]) < key);
+        }
+        return k >> __builtin_ffsll(static_cast<long long>(~k));
+    }
+
+    template <typename K, typename V>
+    typename FrozenIndex<K, V>::size_type FrozenIndex<K, V>::next_(size_type pos) const
+    {
+        if (2 * pos + 1 < slots_.size())
+        {
+            pos = 2 * pos + 1;
+            while (2 * pos < slots_.size())
+            {
+                pos *= 2;
+            }
+            return pos;
+        }
+        // поднимаемся, пока приходим из правого поддерева
+        while (pos & 1)
+        {
+            pos >>= 1;
+        }
+        return pos >> 1;
+    }
+}
+
+#endif // S21_FROZEN_INDEX_H
@@ -0,0 +1,764 @@
+#ifndef S21_COMPACT_MAP_H
+#define S21_COMPACT_MAP_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+
+namespace s21
+{
+
+  // Упорядоченное отображение с компактными узлами: все узлы лежат
+  // подряд в s21::Vector, ссылки - 32-битные номера ячеек, а цвет
+  // красно-чёрного дерева занимает старший бит ссылки на родителя.
+  // На узел уходит 12 байт служебных данных вместо 24 байт указателей
+  // Tree и заголовка malloc у каждого узла; соседние по вставке узлы
+  // соседствуют и в памяти. Дерево сбалансировано, высота не больше
+  // 2 log2(n + 1).
+  //
+  // Удалённый узел замещается последним узлом массива, поэтому
+  // массив всегда плотный. Итераторы хранят номер ячейки: вставка
+  // их не портит (даже при росте массива), удаление портит итераторы
+  // на удалённый и на последний элемент.
+  template <typename K, typename V = K>
+  class CompactMap
+  {
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = size_t;
+
+  private:
+    using index_type = uint32_t;
+
+    static constexpr index_type kRed = index_type(1) << 31;
+    static constexpr index_type kNil = kRed - 1;
+
+    // узлы переезжают при удалении: ключ и значение переносятся в
+    // дыру перемещением, которое не должно бросать
+    static_assert(std::is_nothrow_move_constructible_v<K> &&
+                      std::is_nothrow_move_constructible_v<V>,
+                  "CompactMap needs nothrow move of key and value");
+
+    struct Node
+    {
+      template <typename... Args,
+                typename = std::enable_if_t<std::is_constructible_v<value_type, Args &&...>>>
+      explicit Node(Args &&...args) : data_(std::forward<Args>(args)...) {}
+
+      value_type data_;
+      index_type left_ = kNil;
+      index_type right_ = kNil;
+      // номер родителя | kRed у красного узла
+      index_type parent_ = kNil;
+    };
+
+  public:
+    class iterator
+    {
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = CompactMap::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = value_type *;
+      using reference = value_type &;
+
+      iterator() = default;
+
+      reference operator*() const { return map_->nodes_[index_].data_; }
+      pointer operator->() const { return &map_->nodes_[index_].data_; }
+
+      iterator &operator++()
+      {
+        index_ = map_->next_(index_);
+        return *this;
+      }
+      iterator operator++(int)
+      {
+        iterator old = *this;
+        ++*this;
+        return old;
+      }
+      // --end() - последний элемент
+      iterator &operator--()
+      {
+        index_ = index_ == kNil ? map_->max_(map_->root_) : map_->prev_(index_);
+        return *this;
+      }
+      iterator operator--(int)
+      {
+        iterator old = *this;
+        --*this;
+        return old;
+      }
+
+      bool operator==(const iterator &other) const { return index_ == other.index_; }
+      bool operator!=(const iterator &other) const { return index_ != other.index_; }
+
+    private:
+      friend class CompactMap;
+      iterator(CompactMap *map, index_type index) : map_(map), index_(index) {}
+
+      CompactMap *map_ = nullptr;
+      index_type index_ = kNil;
+    };
+    using const_iterator = iterator;
+
+    CompactMap() = default;
+    CompactMap(std::initializer_list<value_type> init);
+    // массив узлов копируется целиком, ссылки-номера остаются верными
+    CompactMap(const CompactMap &other) : nodes_(other.nodes_), root_(other.root_) {}
+    CompactMap(CompactMap &&other) noexcept { swap(other); }
+    CompactMap &operator=(const CompactMap &other);
+    CompactMap &operator=(CompactMap &&other) noexcept;
+    ~CompactMap() = default;
+
+    mapped_type &at(const key_type &key);
+    const mapped_type &at(const key_type &key) const;
+    mapped_type &operator[](const key_type &key);
+
+    bool empty() const noexcept { return root_ == kNil; }
+    size_type size() const noexcept { return nodes_.size(); }
+    size_type max_size() const noexcept { return kNil; }
+
+    iterator begin() const { return iter_(root_ == kNil ? kNil : min_(root_)); }
+    iterator end() const { return iter_(kNil); }
+
+    std::pair<iterator, bool> insert(const value_type &value);
+    // существующее значение перезаписывается, second = false
+    std::pair<iterator, bool> insert_or_assign(const value_type &value);
+    template <typename... Args>
+    std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+    void erase(iterator pos);
+    void clear() noexcept;
+    void swap(CompactMap &other) noexcept;
+    // переносит элементы с ключами, которых здесь нет
+    void merge(CompactMap &other);
+
+    iterator find(const key_type &key) const { return iter_(find_(key)); }
+    bool contains(const key_type &key) const { return find_(key) != kNil; }
+
+    // память массива узлов
+    void reserve(size_type count) { nodes_.reserve(count); }
+    void shrink_to_fit() { nodes_.shrink_to_fit(); }
+    size_type capacity() const { return nodes_.capacity(); }
+    static constexpr size_type node_bytes() { return sizeof(Node); }
+    size_type memory_bytes() const { return nodes_.capacity() * sizeof(Node); }
+
+  private:
+    iterator iter_(index_type index) const
+    {
+      return iterator(const_cast<CompactMap *>(this), index);
+    }
+
+    Node &node_(index_type i) { return nodes_[i]; }
+    const Node &node_(index_type i) const { return nodes_[i]; }
+    index_type left_(index_type i) const { return node_(i).left_; }
+    index_type right_(index_type i) const { return node_(i).right_; }
+    index_type parent_(index_type i) const { return node_(i).parent_ & ~kRed; }
+    void set_parent_(index_type i, index_type parent)
+    {
+      node_(i).parent_ = (node_(i).parent_ & kRed) | parent;
+    }
+    // пустая ссылка считается чёрной
+    bool red_(index_type i) const { return i != kNil && (node_(i).parent_ & kRed) != 0; }
+    void paint_(index_type i, bool red)
+    {
+      node_(i).parent_ = red ? node_(i).parent_ | kRed : node_(i).parent_ & ~kRed;
+    }
+
+    index_type min_(index_type i) const;
+    index_type max_(index_type i) const;
+    index_type next_(index_type i) const;
+    index_type prev_(index_type i) const;
+    index_type find_(const key_type &key) const;
+
+    template <typename... Args>
+    std::pair<index_type, bool> emplace_(const key_type &key, Args &&...args);
+    void rotate_left_(index_type x);
+    void rotate_right_(index_type x);
+    void insert_fixup_(index_type z);
+    void transplant_(index_type u, index_type v);
+    void erase_fixup_(index_type x, index_type parent);
+    void relocate_last_(index_type hole, std::optional<std::pair<K, V>> &moved) noexcept;
+
+    Vector<Node> nodes_;
+    index_type root_ = kNil;
+  };
+
+  template <typename K, typename V>
+  CompactMap<K, V>::CompactMap(std::initializer_list<value_type> init)
+  {
+    for (const auto &item : init)
+    {
+      insert(item);
+    }
+  }
+
+  template <typename K, typename V>
+  CompactMap<K, V> &CompactMap<K, V>::operator=(const CompactMap &other)
+  {
+    if (this != &other)
+    {
+      CompactMap copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  CompactMap<K, V> &CompactMap<K, V>::operator=(CompactMap &&other) noexcept
+  {
+    if (this != &other)
+    {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  V &CompactMap<K, V>::at(const key_type &key)
+  {
+    index_type i = find_(key);
+    if (i == kNil)
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return node_(i).data_.second;
+  }
+
+  template <typename K, typename V>
+  const V &CompactMap<K, V>::at(const key_type &key) const
+  {
+    return const_cast<CompactMap *>(this)->at(key);
+  }
+
+  template <typename K, typename V>
+  V &CompactMap<K, V>::operator[](const key_type &key)
+  {
+    return node_(emplace_(key, key, mapped_type()).first).data_.second;
+  }
+
+  template <typename K, typename V>
+  std::pair<typename CompactMap<K, V>::iterator, bool>
+  CompactMap<K, V>::insert(const value_type &value)
+  {
+    auto result = emplace_(value.first, value);
+    return {iter_(result.first), result.second};
+  }
+
+  template <typename K, typename V>
+  std::pair<typename CompactMap<K, V>::iterator, bool>
+  CompactMap<K, V>::insert_or_assign(const value_type &value)
+  {
+    auto result = emplace_(value.first, value);
+    if (!result.second)
+    {
+      node_(result.first).data_.second = value.second;
+    }
+    return {iter_(result.first), result.second};
+  }
+
+  template <typename K, typename V>
+  template <typename... Args>
+  std::vector<std::pair<typename CompactMap<K, V>::iterator, bool>>
+  CompactMap<K, V>::insert_many(Args &&...args)
+  {
+    std::vector<std::pair<iterator, bool>> result;
+    (result.push_back(insert(std::forward<Args>(args))), ...);
+    return result;
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::clear() noexcept
+  {
+    nodes_.clear();
+    root_ = kNil;
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::swap(CompactMap &other) noexcept
+  {
+    nodes_.swap(other.nodes_);
+    std::swap(root_, other.root_);
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::merge(CompactMap &other)
+  {
+    if (this == &other)
+    {
+      return;
+    }
+    // удаление переставляет узлы other, поэтому идём по ключам
+    std::vector<key_type> moved;
+    for (const auto &item : other)
+    {
+      if (insert(item).second)
+      {
+        moved.push_back(item.first);
+      }
+    }
+    for (const auto &key : moved)
+    {
+      other.erase(other.find(key));
+    }
+  }
+
+  template <typename K, typename V>
+  typename CompactMap<K, V>::index_type CompactMap<K, V>::min_(index_type i) const
+  {
+    while (left_(i) != kNil)
+    {
+      i = left_(i);
+    }
+    return i;
+  }
+
+  template <typename K, typename V>
+  typename CompactMap<K, V>::index_type CompactMap<K, V>::max_(index_type i) const
+  {
+    if (i == kNil)
+    {
+      return kNil;
+    }
+    while (right_(i) != kNil)
+    {
+      i = right_(i);
+    }
+    return i;
+  }
+
+  template <typename K, typename V>
+  typename CompactMap<K, V>::index_type CompactMap<K, V>::next_(index_type i) const
+  {
+    if (right_(i) != kNil)
+    {
+      return min_(right_(i));
+    }
+    index_type parent = parent_(i);
+    while (parent != kNil && right_(parent) == i)
+    {
+      i = parent;
+      parent = parent_(i);
+    }
+    return parent;
+  }
+
+  template <typename K, typename V>
+  typename CompactMap<K, V>::index_type CompactMap<K, V>::prev_(index_type i) const
+  {
+    if (left_(i) != kNil)
+    {
+      return max_(left_(i));
+    }
+    index_type parent = parent_(i);
+    while (parent != kNil && left_(parent) == i)
+    {
+      i = parent;
+      parent = parent_(i);
+    }
+    return parent;
+  }
+
+  template <typename K, typename V>
+  typename CompactMap<K, V>::index_type CompactMap<K, V>::find_(const key_type &key) const
+  {
+    index_type i = root_;
+    while (i != kNil)
+    {
+      const Node &node = node_(i);
+      if (key < node.data_.first)
+      {
+        i = node.left_;
+      }
+      else if (node.data_.first < key)
+      {
+        i = node.right_;
+      }
+      else
+      {
+        return i;
+      }
+    }
+    return kNil;
+  }
+
+  // args - аргументы конструктора value_type; новый узел красный
+  template <typename K, typename V>
+  template <typename... Args>
+  std::pair<typename CompactMap<K, V>::index_type, bool>
+  CompactMap<K, V>::emplace_(const key_type &key, Args &&...args)
+  {
+    index_type parent = kNil;
+    index_type i = root_;
+    bool left = false;
+    while (i != kNil)
+    {
+      const Node &node = node_(i);
+      parent = i;
+      if (key < node.data_.first)
+      {
+        left = true;
+        i = node.left_;
+      }
+      else if (node.data_.first < key)
+      {
+        left = false;
+        i = node.right_;
+      }
+      else
+      {
+        return {i, false};
+      }
+    }
+    if (nodes_.size() >= kNil)
+    {
+      throw std::length_error("CompactMap is full");
+    }
+    index_type z = static_cast<index_type>(nodes_.size());
+    nodes_.emplace_back(std::forward<Args>(args)...);
+    node_(z).parent_ = parent | kRed;
+    if (parent == kNil)
+    {
+      root_ = z;
+    }
+    else if (left)
+    {
+      node_(parent).left_ = z;
+    }
+    else
+    {
+      node_(parent).right_ = z;
+    }
+    insert_fixup_(z);
+    return {z, true};
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::rotate_left_(index_type x)
+  {
+    index_type y = right_(x);
+    node_(x).right_ = left_(y);
+    if (left_(y) != kNil)
+    {
+      set_parent_(left_(y), x);
+    }
+    index_type parent = parent_(x);
+    set_parent_(y, parent);
+    if (parent == kNil)
+    {
+      root_ = y;
+    }
+    else if (left_(parent) == x)
+    {
+      node_(parent).left_ = y;
+    }
+    else
+    {
+      node_(parent).right_ = y;
+    }
+    node_(y).left_ = x;
+    set_parent_(x, y);
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::rotate_right_(index_type x)
+  {
+    index_type y = left_(x);
+    node_(x).left_ = right_(y);
+    if (right_(y) != kNil)
+    {
+      set_parent_(right_(y), x);
+    }
+    index_type parent = parent_(x);
+    set_parent_(y, parent);
+    if (parent == kNil)
+    {
+      root_ = y;
+    }
+    else if (right_(parent) == x)
+    {
+      node_(parent).right_ = y;
+    }
+    else
+    {
+      node_(parent).left_ = y;
+    }
+    node_(y).right_ = x;
+    set_parent_(x, y);
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::insert_fixup_(index_type z)
+  {
+    while (red_(parent_(z)))
+    {
+      index_type parent = parent_(z);
+      index_type grand = parent_(parent);
+      if (parent == left_(grand))
+      {
+        index_type uncle = right_(grand);
+        if (red_(uncle))
+        {
+          paint_(parent, false);
+          paint_(uncle, false);
+          paint_(grand, true);
+          z = grand;
+          continue;
+        }
+        if (z == right_(parent))
+        {
+          z = parent;
+          rotate_left_(z);
+          parent = parent_(z);
+        }
+        paint_(parent, false);
+        paint_(grand, true);
+        rotate_right_(grand);
+      }
+      else
+      {
+        index_type uncle = left_(grand);
+        if (red_(uncle))
+        {
+          paint_(parent, false);
+          paint_(uncle, false);
+          paint_(grand, true);
+          z = grand;
+          continue;
+        }
+        if (z == left_(parent))
+        {
+          z = parent;
+          rotate_right_(z);
+          parent = parent_(z);
+        }
+        paint_(parent, false);
+        paint_(grand, true);
+        rotate_left_(grand);
+      }
+    }
+    paint_(root_, false);
+  }
+
+  // v занимает место u у родителя u
+  template <typename K, typename V>
+  void CompactMap<K, V>::transplant_(index_type u, index_type v)
+  {
+    index_type parent = parent_(u);
+    if (parent == kNil)
+    {
+      root_ = v;
+    }
+    else if (left_(parent) == u)
+    {
+      node_(parent).left_ = v;
+    }
+    else
+    {
+      node_(parent).right_ = v;
+    }
+    if (v != kNil)
+    {
+      set_parent_(v, parent);
+    }
+  }
+
+  template <typename K, typename V>
+  void CompactMap<K, V>::erase(iterator pos)
+  {
+    index_type z = pos.index_;
+    if (z == kNil)
+    {
+      throw std::out_of_range("Erase of end() in CompactMap");
+    }
+    // последний узел переедет на место z; копия его константного
+    // ключа может бросить, поэтому делается до изменения дерева
+    index_type last = static_cast<index_type>(nodes_.size() - 1);
+    std::optional<std::pair<K, V>> moved;
+    if (z != last)
+    {
+      moved.emplace(node_(last).data_.first, std::move(node_(last).data_.second));
+    }
+    index_type x;
+    index_type x_parent;
+    bool removed_red = red_(z);
+    if (left_(z) == kNil)
+    {
+      x = right_(z);
+      x_parent = parent_(z);
+      transplant_(z, x);
+    }
+    else if (right_(z) == kNil)
+    {
+      x = left_(z);
+      x_parent = parent_(z);
+      transplant_(z, x);
+    }
+    else
+    {
+      // z заменяет его преемник y
+      index_type y = min_(right_(z));
+      removed_red = red_(y);
+      x = right_(y);
+      if (parent_(y) == z)
+      {
+        x_parent = y;
+      }
+      else
+      {
+        x_parent = parent_(y);
+        transplant_(y, x);
+        node_(y).right_ = right_(z);
+        set_parent_(right_(y), y);
+      }
+      transplant_(z, y);
+      node_(y).left_ = left_(z);
+      set_parent_(left_(y), y);
+      paint_(y, red_(z));
+    }
+    if (!removed_red)
+    {
+      erase_fixup_(x, x_parent);
+    }
+    relocate_last_(z, moved);
+  }
+
+  // x - узел с лишним чёрным (может быть пустым), parent - его родитель
+  template <typename K, typename V>
+  void CompactMap<K, V>::erase_fixup_(index_type x, index_type parent)
+  {
+    while (x != root_ && !red_(x))
+    {
+      if (x == left_(parent))
+      {
+        index_type w = right_(parent);
+        if (red_(w))
+        {
+          paint_(w, false);
+          paint_(parent, true);
+          rotate_left_(parent);
+          w = right_(parent);
+        }
+        if (!red_(left_(w)) && !red_(right_(w)))
+        {
+          paint_(w, true);
+          x = parent;
+          parent = parent_(x);
+          continue;
+        }
+        if (!red_(right_(w)))
+        {
+          paint_(left_(w), false);
+          paint_(w, true);
+          rotate_right_(w);
+          w = right_(parent);
+        }
+        paint_(w, red_(parent));
+        paint_(parent, false);
+        paint_(right_(w), false);
+        rotate_left_(parent);
+      }
+      else
+      {
+        index_type w = left_(parent);
+        if (red_(w))
+        {
+          paint_(w, false);
+          paint_(parent, true);
+          rotate_right_(parent);
+          w = left_(parent);
+        }
+        if (!red_(left_(w)) && !red_(right_(w)))
+        {
+          paint_(w, true);
+          x = parent;
+          parent = parent_(x);
+          continue;
+        }
+        if (!red_(left_(w)))
+        {
+          paint_(right_(w), false);
+          paint_(w, true);
+          rotate_left_(w);
+          w = left_(parent);
+        }
+        paint_(w, red_(parent));
+        paint_(parent, false);
+        paint_(left_(w), false);
+        rotate_right_(parent);
+      }
+      x = root_;
+    }
+    if (x != kNil)
+    {
+      paint_(x, false);
+    }
+  }
+
+  // ячейка hole уже выведена из дерева: в неё переезжает последний
+  // узел массива (его ключ и значение заранее вынуты в moved),
+  // ссылки на него исправляются
+  template <typename K, typename V>
+  void CompactMap<K, V>::relocate_last_(index_type hole,
+                                        std::optional<std::pair<K, V>> &moved) noexcept
+  {
+    index_type last = static_cast<index_type>(nodes_.size() - 1);
+    if (hole != last)
+    {
+      index_type parent = parent_(last);
+      if (parent == kNil)
+      {
+        root_ = hole;
+      }
+      else if (left_(parent) == last)
+      {
+        node_(parent).left_ = hole;
+      }
+      else
+      {
+        node_(parent).right_ = hole;
+      }
+      if (left_(last) != kNil)
+      {
+        set_parent_(left_(last), hole);
+      }
+      if (right_(last) != kNil)
+      {
+        set_parent_(right_(last), hole);
+      }
+      const Node &from = node_(last);
+      index_type left = from.left_;
+      index_type right = from.right_;
+      index_type parent_and_color = from.parent_;
+      Node *slot = &node_(hole);
+      std::destroy_at(slot);
+      ::new (static_cast<void *>(slot)) Node(std::move(moved->first), std::move(moved->second));
+      slot->left_ = left;
+      slot->right_ = right;
+      slot->parent_ = parent_and_color;
+    }
+    nodes_.pop_back();
+    if (nodes_.empty())
+    {
+      root_ = kNil;
+    }
+  }
+}
+
+#endif // S21_COMPACT_MAP_H
@@ -0,0 +1,517 @@
+#ifndef S21_INTERVAL_MAP_H
+#define S21_INTERVAL_MAP_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../s21_alloc_stats.h"
+
+namespace s21
+{
+
+  // Отображение замкнутых интервалов [low, high] в значения с
+  // запросами пересечения. Узлы устроены как в Tree (parent/left/right,
+  // ключ - пара (low, high), повторы разрешены), и каждый узел хранит
+  // max_high - наибольший правый конец в своём поддереве. Поиск
+  // отсекает поддеревья, где max_high < a, и правые поддеревья узлов
+  // с low > b. Отсечение не даёт O(h + k): проходятся все предки
+  // каждого из k найденных интервалов, так что запрос стоит
+  // O(min(n, k h)), т.е. ожидаемо O(min(n, k log n)), и O(h), если
+  // пересечений нет.
+  //
+  // Tree не балансируется, а для интервалов из временных окон вставка
+  // почти всегда упорядочена. Поэтому здесь дерамида: каждый узел
+  // получает случайный приоритет, и повороты держат его выше потомков.
+  // Ожидаемая высота O(log n) при любом порядке вставки; max_high
+  // пересчитывается на пути вставки/удаления и в каждом повороте.
+  template <typename K, typename V>
+  class IntervalMap : private alloc_stats::Tracker<>
+  {
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = size_t;
+
+    struct value_type
+    {
+      const key_type low;
+      const key_type high;
+      mapped_type value;
+    };
+
+  private:
+    struct Node
+    {
+      template <typename... Args>
+      Node(const key_type &low, const key_type &high, Args &&...args)
+          : data_{low, high, mapped_type(std::forward<Args>(args)...)},
+            max_high_(high) {}
+
+      value_type data_;
+      key_type max_high_;
+      uint64_t priority_ = 0;
+      Node *parent_ = nullptr;
+      Node *left_ = nullptr;
+      Node *right_ = nullptr;
+    };
+
+  public:
+    class iterator
+    {
+    public:
+      iterator() = default;
+
+      value_type &operator*() const { return node_->data_; }
+      value_type *operator->() const { return &node_->data_; }
+
+      // симметричный порядок: по low, затем по high
+      iterator &operator++()
+      {
+        if (node_->right_ != nullptr)
+        {
+          node_ = node_->right_;
+          while (node_->left_ != nullptr)
+          {
+            node_ = node_->left_;
+          }
+          return *this;
+        }
+        Node *from = node_;
+        node_ = node_->parent_;
+        while (node_ != nullptr && node_->right_ == from)
+        {
+          from = node_;
+          node_ = node_->parent_;
+        }
+        return *this;
+      }
+      iterator operator++(int)
+      {
+        iterator old = *this;
+        ++*this;
+        return old;
+      }
+
+      bool operator==(const iterator &other) const { return node_ == other.node_; }
+      bool operator!=(const iterator &other) const { return node_ != other.node_; }
+
+    private:
+      friend class IntervalMap;
+      explicit iterator(Node *node) : node_(node) {}
+
+      Node *node_ = nullptr;
+    };
+
+    IntervalMap() = default;
+    IntervalMap(const IntervalMap &other);
+    IntervalMap(IntervalMap &&other) noexcept { swap(other); }
+    IntervalMap &operator=(const IntervalMap &other);
+    IntervalMap &operator=(IntervalMap &&other) noexcept;
+    ~IntervalMap() { clear(); }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    iterator begin() const;
+    iterator end() const { return iterator(); }
+
+    // high < low - std::invalid_argument
+    template <typename... Args>
+    iterator emplace(const key_type &low, const key_type &high, Args &&...args);
+    iterator insert(const key_type &low, const key_type &high, const mapped_type &value)
+    {
+      return emplace(low, high, value);
+    }
+
+    // какой-нибудь из интервалов, равных [low, high], или end()
+    iterator find(const key_type &low, const key_type &high) const;
+    void erase(iterator pos);
+    // удаляет один интервал [low, high], false - если его нет
+    bool erase(const key_type &low, const key_type &high);
+    void clear() noexcept;
+    void swap(IntervalMap &other) noexcept;
+
+    // интервалы, пересекающие [a, b], в порядке возрастания low;
+    // O(min(n, k log n)) для k найденных
+    std::vector<iterator> overlapping(const key_type &a, const key_type &b) const;
+    // интервалы, содержащие x
+    std::vector<iterator> stabbing(const key_type &x) const { return overlapping(x, x); }
+    // то же без выделения памяти: visit(value_type &) на каждый интервал
+    template <typename Visit>
+    void for_each_overlapping(const key_type &a, const key_type &b, Visit &&visit) const;
+
+    // счётчики выделений узлов (нули при S21_ALLOC_STATS=0)
+    using alloc_stats::Tracker<>::alloc_stats;
+
+  private:
+    static bool less_(const key_type &low, const key_type &high, const Node *node)
+    {
+      return low < node->data_.low ||
+             (!(node->data_.low < low) && high < node->data_.high);
+    }
+
+    void pull_(Node *node) const noexcept;
+    void rotate_up_(Node *x) noexcept;
+    void recompute_path_(Node *node) noexcept;
+    uint64_t next_priority_() noexcept;
+    template <typename Visit>
+    void visit_(Node *node, const key_type &a, const key_type &b, Visit &visit) const;
+    void copy_(const Node *node, Node *&slot, Node *parent);
+
+    template <typename... Args>
+    Node *make_node_(Args &&...args);
+    void drop_node_(Node *node) noexcept;
+
+    Node *root_ = nullptr;
+    size_type size_ = 0;
+    // состояние splitmix64 для приоритетов
+    uint64_t seed_ = 0x2545F4914F6CDD1DULL;
+  };
+
+  template <typename K, typename V>
+  IntervalMap<K, V>::IntervalMap(const IntervalMap &other)
+      : alloc_stats::Tracker<>(), seed_(other.seed_)
+  {
+    try
+    {
+      copy_(other.root_, root_, nullptr);
+    }
+    catch (...)
+    {
+      clear();
+      throw;
+    }
+    size_ = other.size_;
+  }
+
+  template <typename K, typename V>
+  IntervalMap<K, V> &IntervalMap<K, V>::operator=(const IntervalMap &other)
+  {
+    if (this != &other)
+    {
+      IntervalMap copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  IntervalMap<K, V> &IntervalMap<K, V>::operator=(IntervalMap &&other) noexcept
+  {
+    if (this != &other)
+    {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  typename IntervalMap<K, V>::iterator IntervalMap<K, V>::begin() const
+  {
+    Node *node = root_;
+    while (node != nullptr && node->left_ != nullptr)
+    {
+      node = node->left_;
+    }
+    return iterator(node);
+  }
+
+  template <typename K, typename V>
+  template <typename... Args>
+  typename IntervalMap<K, V>::iterator
+  IntervalMap<K, V>::emplace(const key_type &low, const key_type &high, Args &&...args)
+  {
+    if (high < low)
+    {
+      throw std::invalid_argument("Interval end is less than its start");
+    }
+    Node *node = make_node_(low, high, std::forward<Args>(args)...);
+    node->priority_ = next_priority_();
+
+    Node *parent = nullptr;
+    Node **link = &root_;
+    while (*link != nullptr)
+    {
+      parent = *link;
+      if (parent->max_high_ < high)
+      {
+        parent->max_high_ = high;
+      }
+      link = less_(low, high, parent) ? &parent->left_ : &parent->right_;
+    }
+    *link = node;
+    node->parent_ = parent;
+    while (node->parent_ != nullptr && node->parent_->priority_ < node->priority_)
+    {
+      rotate_up_(node);
+    }
+    ++size_;
+    return iterator(node);
+  }
+
+  template <typename K, typename V>
+  typename IntervalMap<K, V>::iterator
+  IntervalMap<K, V>::find(const key_type &low, const key_type &high) const
+  {
+    Node *node = root_;
+    while (node != nullptr)
+    {
+      if (less_(low, high, node))
+      {
+        node = node->left_;
+      }
+      else if (node->data_.low < low || node->data_.high < high)
+      {
+        node = node->right_;
+      }
+      else
+      {
+        return iterator(node);
+      }
+    }
+    return end();
+  }
+
+  // узел опускается поворотами под потомка с большим приоритетом,
+  // пока у него не останется одного потомка, и вырезается
+  template <typename K, typename V>
+  void IntervalMap<K, V>::erase(iterator pos)
+  {
+    Node *node = pos.node_;
+    if (node == nullptr)
+    {
+      throw std::out_of_range("Erase of end() in IntervalMap");
+    }
+    while (node->left_ != nullptr && node->right_ != nullptr)
+    {
+      rotate_up_(node->left_->priority_ > node->right_->priority_ ? node->left_
+                                                                  : node->right_);
+    }
+    Node *child = node->left_ != nullptr ? node->left_ : node->right_;
+    Node *parent = node->parent_;
+    if (child != nullptr)
+    {
+      child->parent_ = parent;
+    }
+    if (parent == nullptr)
+    {
+      root_ = child;
+    }
+    else if (parent->left_ == node)
+    {
+      parent->left_ = child;
+    }
+    else
+    {
+      parent->right_ = child;
+    }
+    recompute_path_(parent);
+    drop_node_(node);
+    --size_;
+  }
+
+  template <typename K, typename V>
+  bool IntervalMap<K, V>::erase(const key_type &low, const key_type &high)
+  {
+    iterator pos = find(low, high);
+    if (pos == end())
+    {
+      return false;
+    }
+    erase(pos);
+    return true;
+  }
+
+  template <typename K, typename V>
+  void IntervalMap<K, V>::clear() noexcept
+  {
+    // обход без стека: левое поддерево поворотом переносится вправо
+    Node *node = root_;
+    while (node != nullptr)
+    {
+      if (node->left_ != nullptr)
+      {
+        Node *left = node->left_;
+        node->left_ = left->right_;
+        left->right_ = node;
+        node = left;
+      }
+      else
+      {
+        Node *right = node->right_;
+        drop_node_(node);
+        node = right;
+      }
+    }
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  template <typename K, typename V>
+  void IntervalMap<K, V>::swap(IntervalMap &other) noexcept
+  {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(seed_, other.seed_);
+    swap_alloc_stats_(other);
+  }
+
+  template <typename K, typename V>
+  std::vector<typename IntervalMap<K, V>::iterator>
+  IntervalMap<K, V>::overlapping(const key_type &a, const key_type &b) const
+  {
+    std::vector<iterator> result;
+    if (!(b < a))
+    {
+      auto collect = [&result](Node *node) { result.push_back(iterator(node)); };
+      visit_(root_, a, b, collect);
+    }
+    return result;
+  }
+
+  template <typename K, typename V>
+  template <typename Visit>
+  void IntervalMap<K, V>::for_each_overlapping(const key_type &a, const key_type &b,
+                                               Visit &&visit) const
+  {
+    if (!(b < a))
+    {
+      auto call = [&visit](Node *node) { visit(node->data_); };
+      visit_(root_, a, b, call);
+    }
+  }
+
+  // [low, high] пересекает [a, b], если low <= b и a <= high
+  template <typename K, typename V>
+  template <typename Visit>
+  void IntervalMap<K, V>::visit_(Node *node, const key_type &a, const key_type &b,
+                                 Visit &visit) const
+  {
+    while (node != nullptr && !(node->max_high_ < a))
+    {
+      visit_(node->left_, a, b, visit);
+      if (b < node->data_.low)
+      {
+        return;
+      }
+      if (!(node->data_.high < a))
+      {
+        visit(node);
+      }
+      node = node->right_;
+    }
+  }
+
+  template <typename K, typename V>
+  void IntervalMap<K, V>::pull_(Node *node) const noexcept
+  {
+    node->max_high_ = node->data_.high;
+    if (node->left_ != nullptr && node->max_high_ < node->left_->max_high_)
+    {
+      node->max_high_ = node->left_->max_high_;
+    }
+    if (node->right_ != nullptr && node->max_high_ < node->right_->max_high_)
+    {
+      node->max_high_ = node->right_->max_high_;
+    }
+  }
+
+  // x занимает место родителя; max_high меняется только у этих двоих
+  template <typename K, typename V>
+  void IntervalMap<K, V>::rotate_up_(Node *x) noexcept
+  {
+    Node *parent = x->parent_;
+    Node *grand = parent->parent_;
+    if (parent->left_ == x)
+    {
+      parent->left_ = x->right_;
+      if (x->right_ != nullptr)
+      {
+        x->right_->parent_ = parent;
+      }
+      x->right_ = parent;
+    }
+    else
+    {
+      parent->right_ = x->left_;
+      if (x->left_ != nullptr)
+      {
+        x->left_->parent_ = parent;
+      }
+      x->left_ = parent;
+    }
+    parent->parent_ = x;
+    x->parent_ = grand;
+    if (grand == nullptr)
+    {
+      root_ = x;
+    }
+    else if (grand->left_ == parent)
+    {
+      grand->left_ = x;
+    }
+    else
+    {
+      grand->right_ = x;
+    }
+    pull_(parent);
+    pull_(x);
+  }
+
+  template <typename K, typename V>
+  void IntervalMap<K, V>::recompute_path_(Node *node) noexcept
+  {
+    for (; node != nullptr; node = node->parent_)
+    {
+      pull_(node);
+    }
+  }
+
+  template <typename K, typename V>
+  uint64_t IntervalMap<K, V>::next_priority_() noexcept
+  {
+    uint64_t z = (seed_ += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  // копия сохраняет форму и приоритеты; узел подвешивается к
+  // родителю сразу, так что при исключении clear() найдёт всё
+  // скопированное. Глубина рекурсии - высота дерева
+  template <typename K, typename V>
+  void IntervalMap<K, V>::copy_(const Node *node, Node *&slot, Node *parent)
+  {
+    if (node == nullptr)
+    {
+      return;
+    }
+    slot = make_node_(node->data_.low, node->data_.high, node->data_.value);
+    slot->priority_ = node->priority_;
+    slot->max_high_ = node->max_high_;
+    slot->parent_ = parent;
+    copy_(node->left_, slot->left_, slot);
+    copy_(node->right_, slot->right_, slot);
+  }
+
+  template <typename K, typename V>
+  template <typename... Args>
+  typename IntervalMap<K, V>::Node *IntervalMap<K, V>::make_node_(Args &&...args)
+  {
+    Node *node = new Node(std::forward<Args>(args)...);
+    on_allocate_(alloc_stats::Source::kTree, sizeof(Node));
+    return node;
+  }
+
+  template <typename K, typename V>
+  void IntervalMap<K, V>::drop_node_(Node *node) noexcept
+  {
+    on_free_(alloc_stats::Source::kTree, sizeof(Node));
+    delete node;
+  }
+}
+
+#endif // S21_INTERVAL_MAP_H
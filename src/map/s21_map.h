@@ -3,13 +3,19 @@
 
 #include <vector>
 #include <iostream>
+#include <type_traits>
 
+#include "../frozen/s21_frozen_index.h"
+#include "../s21_serialize.h"
 #include "../tree.h"
 
 namespace s21
 {
 
-  template <typename K, typename V = K>
+  // Tracer - политика трассировки операций дерева (см. s21_trace.h),
+  // Prefix - префикс ключа в узлах (см. KeyPrefix в tree.h)
+  template <typename K, typename V = K, typename Tracer = trace::NoTrace,
+            typename Prefix = KeyPrefix<K>>
   class Map
   {
   public:
@@ -17,7 +23,7 @@ namespace s21
     using mapped_type = V;
     using value_type = std::pair<const key_type, mapped_type>;
     using size_type = size_t;
-    using iterator = typename Tree<key_type, mapped_type>::iterator;
+    using iterator = typename Tree<key_type, mapped_type, Tracer, Prefix>::iterator;
 
     Map() : tree_() {}
     Map(std::initializer_list<value_type> init) : tree_(init) {}
@@ -75,14 +81,96 @@ namespace s21
 
     void swap(Map &other) { tree_.swap(other.tree_); }
 
+    // счётчики выделений узлов (нули при S21_ALLOC_STATS=0)
+    alloc_stats::Counters alloc_stats() const { return tree_.alloc_stats(); }
+
+    const Tracer &tracer() const { return tree_.tracer(); }
+
+    // кэш найденных узлов перед поиском по дереву (см. tree.h)
+    void set_lookup_cache(size_type slots, size_type ways = 1)
+    {
+      tree_.set_lookup_cache(slots, ways);
+    }
+    LookupCacheStats lookup_cache_stats() const
+    {
+      return tree_.lookup_cache_stats();
+    }
+
+    // перестройка дерева при поиске (см. AccessMode в tree.h)
+    void set_access_mode(AccessMode mode) noexcept { tree_.set_access_mode(mode); }
+    AccessMode access_mode() const noexcept { return tree_.access_mode(); }
+
+    // форма дерева (см. TreeStats в tree.h)
+    TreeStats stats() const { return tree_.stats(); }
+    void track_height(bool enabled) { tree_.track_height(enabled); }
+    size_type height_bound() const { return tree_.height_bound(); }
+
+    // неизменяемая копия для поиска (см. frozen/s21_frozen_index.h)
+    FrozenIndex<key_type, mapped_type> freeze() const
+    {
+      std::vector<std::pair<key_type, mapped_type>> items;
+      items.reserve(size());
+      for (iterator it = begin(); it != end(); ++it)
+      {
+        items.emplace_back(it->first, it->second);
+      }
+      return FrozenIndex<key_type, mapped_type>(items);
+    }
+
     template <typename... Args>
     std::vector<std::pair<iterator, bool>> insert_many(Args &&...args)
     {
       return tree_.insert_many(std::forward<Args>(args)...);
     }
 
+    // двоичное сохранение/загрузка, формат описан в s21_serialize.h;
+    // отсортированные данные загружаются в дерево за O(n)
+    void save(std::ostream &out) const
+    {
+      serialize::write_header(out, serialize::kMap, kPod,
+                              sizeof(key_type) + sizeof(mapped_type), size());
+      for (iterator it = begin(); it != end(); ++it)
+      {
+        serialize::write_value(out, it->first);
+        serialize::write_value(out, it->second);
+      }
+    }
+
+    void load(std::istream &in)
+    {
+      uint64_t count = serialize::read_header(
+          in, serialize::kMap, kPod, sizeof(key_type) + sizeof(mapped_type));
+      std::vector<std::pair<key_type, mapped_type>> items;
+      items.reserve(serialize::reserve_hint(count));
+      bool sorted = true;
+      for (uint64_t i = 0; i < count; ++i)
+      {
+        std::pair<key_type, mapped_type> item;
+        serialize::read_value(in, item.first);
+        serialize::read_value(in, item.second);
+        sorted = sorted && (items.empty() || items.back().first < item.first);
+        items.push_back(std::move(item));
+      }
+      if (sorted)
+      {
+        tree_.assign_sorted(items.begin(), items.end());
+        return;
+      }
+      tree_.clear();
+      for (const auto &item : items)
+      {
+        tree_.insert(item);
+      }
+    }
+
+    void save(int fd) const { serialize::save_fd(*this, fd); }
+    void load(int fd) { serialize::load_fd(*this, fd); }
+
   private:
-    Tree<key_type, mapped_type> tree_;
+    static constexpr bool kPod = std::is_trivially_copyable_v<key_type> &&
+                                 std::is_trivially_copyable_v<mapped_type>;
+
+    Tree<key_type, mapped_type, Tracer, Prefix> tree_;
   };
 
 } // namespace s21
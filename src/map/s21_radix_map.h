@@ -0,0 +1,1295 @@
+#ifndef S21_RADIX_MAP_H
+#define S21_RADIX_MAP_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../s21_alloc_stats.h"
+
+namespace s21
+{
+
+  // Ключ RadixMap как строка байт, сравнение которой побайтно без
+  // знака (memcmp) даёт тот же порядок, что и operator< ключа.
+  // Целые - big-endian, у знаковых инвертирован старший бит; строки
+  // берутся как есть.
+  template <typename K, typename = void>
+  struct RadixKey;
+
+  template <typename K>
+  struct RadixKey<K, std::enable_if_t<std::is_integral_v<K>>>
+  {
+    using buffer = std::array<unsigned char, sizeof(K)>;
+
+    static std::string_view encode(const K &key, buffer &out)
+    {
+      using U = std::make_unsigned_t<K>;
+      U bits = static_cast<U>(key);
+      if constexpr (std::is_signed_v<K>)
+      {
+        bits ^= static_cast<U>(U(1) << (sizeof(K) * 8 - 1));
+      }
+      for (size_t i = sizeof(K); i-- > 0;)
+      {
+        out[i] = static_cast<unsigned char>(bits & 0xFF);
+        bits = static_cast<U>(bits >> 8);
+      }
+      return std::string_view(reinterpret_cast<const char *>(out.data()), sizeof(K));
+    }
+  };
+
+  template <>
+  struct RadixKey<std::string>
+  {
+    struct buffer
+    {
+    };
+
+    static std::string_view encode(const std::string &key, buffer &) { return key; }
+  };
+
+  // Упорядоченное отображение на адаптивном префиксном дереве (ART).
+  // Внутренние узлы ветвятся по одному байту ключа и бывают четырёх
+  // размеров: Node4 и Node16 - отсортированные массивы байт (Node16
+  // ищет байт одной SSE2-командой), Node48 - таблица байт -> ячейка,
+  // Node256 - прямой массив. Узел растёт и сжимается по числу детей.
+  //
+  // Цепочки узлов с одним потомком схлопнуты в префикс узла
+  // (prefix_len_ байт). Храним первые kMaxPrefix байт; поиск
+  // пропускает остальное вслепую и проверяет ключ в листе, а вставка
+  // и удаление добирают недостающие байты из любого листа поддерева.
+  // Ключ, закончившийся внутри дерева (строка - префикс другой
+  // строки), хранится в value_ узла и идёт раньше его детей.
+  //
+  // Листья связаны двусвязным списком в порядке ключей: итерация -
+  // проход по списку, а префиксный диапазон [first, last) - самый
+  // левый и следующий за самым правым лист поддерева.
+  template <typename K, typename V = K>
+  class RadixMap : private alloc_stats::Tracker<>
+  {
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = size_t;
+
+  private:
+    using Traits = RadixKey<key_type>;
+    using buffer = typename Traits::buffer;
+
+    static constexpr uint32_t kMaxPrefix = 8;
+
+    enum Type : uint8_t
+    {
+      kLeaf,
+      kNode4,
+      kNode16,
+      kNode48,
+      kNode256
+    };
+
+    struct Base
+    {
+      explicit Base(uint8_t type) : type_(type) {}
+      uint8_t type_;
+    };
+
+    struct Leaf : Base
+    {
+      template <typename... Args>
+      explicit Leaf(Args &&...args) : Base(kLeaf), data_(std::forward<Args>(args)...) {}
+
+      value_type data_;
+      Leaf *prev_ = nullptr;
+      Leaf *next_ = nullptr;
+    };
+
+    struct Inner : Base
+    {
+      explicit Inner(uint8_t type) : Base(type) {}
+
+      uint16_t count_ = 0;
+      uint32_t prefix_len_ = 0;
+      unsigned char prefix_[kMaxPrefix] = {};
+      Leaf *value_ = nullptr;
+    };
+
+    struct Node4 : Inner
+    {
+      Node4() : Inner(kNode4) {}
+      unsigned char keys_[4] = {};
+      Base *children_[4] = {};
+    };
+
+    struct Node16 : Inner
+    {
+      Node16() : Inner(kNode16) {}
+      unsigned char keys_[16] = {};
+      Base *children_[16] = {};
+    };
+
+    struct Node48 : Inner
+    {
+      Node48() : Inner(kNode48) {}
+      // 0 - нет потомка, иначе номер ячейки + 1
+      unsigned char index_[256] = {};
+      Base *children_[48] = {};
+    };
+
+    struct Node256 : Inner
+    {
+      Node256() : Inner(kNode256) {}
+      Base *children_[256] = {};
+    };
+
+  public:
+    class iterator
+    {
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = RadixMap::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = value_type *;
+      using reference = value_type &;
+
+      iterator() = default;
+
+      reference operator*() const { return leaf_->data_; }
+      value_type *operator->() const { return &leaf_->data_; }
+
+      iterator &operator++()
+      {
+        leaf_ = leaf_->next_;
+        return *this;
+      }
+      iterator operator++(int)
+      {
+        iterator old = *this;
+        ++*this;
+        return old;
+      }
+      // --end() - последний элемент
+      iterator &operator--()
+      {
+        leaf_ = leaf_ != nullptr ? leaf_->prev_ : map_->tail_;
+        return *this;
+      }
+      iterator operator--(int)
+      {
+        iterator old = *this;
+        --*this;
+        return old;
+      }
+
+      bool operator==(const iterator &other) const { return leaf_ == other.leaf_; }
+      bool operator!=(const iterator &other) const { return leaf_ != other.leaf_; }
+
+    private:
+      friend class RadixMap;
+      iterator(Leaf *leaf, const RadixMap *map) : leaf_(leaf), map_(map) {}
+
+      Leaf *leaf_ = nullptr;
+      const RadixMap *map_ = nullptr;
+    };
+    using const_iterator = iterator;
+
+    RadixMap() = default;
+    RadixMap(std::initializer_list<value_type> init);
+    RadixMap(const RadixMap &other);
+    RadixMap(RadixMap &&other) noexcept { swap(other); }
+    RadixMap &operator=(const RadixMap &other);
+    RadixMap &operator=(RadixMap &&other) noexcept;
+    ~RadixMap() { clear(); }
+
+    mapped_type &at(const key_type &key);
+    const mapped_type &at(const key_type &key) const;
+    mapped_type &operator[](const key_type &key);
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept
+    {
+      return std::numeric_limits<size_type>::max() / sizeof(Leaf);
+    }
+
+    iterator begin() const { return iterator(head_, this); }
+    iterator end() const { return iterator(nullptr, this); }
+
+    std::pair<iterator, bool> insert(const value_type &value);
+    // существующее значение перезаписывается, second = false
+    std::pair<iterator, bool> insert_or_assign(const value_type &value);
+    template <typename... Args>
+    std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+    void erase(iterator pos);
+    void clear() noexcept;
+    void swap(RadixMap &other) noexcept;
+    // переносит элементы с ключами, которых здесь нет
+    void merge(RadixMap &other);
+
+    iterator find(const key_type &key) const { return iterator(find_leaf_(key), this); }
+    bool contains(const key_type &key) const { return find_leaf_(key) != nullptr; }
+
+    // Элементы, чей закодированный ключ (см. RadixKey) начинается с
+    // prefix: для строк - обычный строковый префикс, для целых -
+    // старшие байты в порядке big-endian.
+    std::pair<iterator, iterator> prefix_range(std::string_view prefix) const;
+
+    // счётчики выделений узлов (нули при S21_ALLOC_STATS=0)
+    using alloc_stats::Tracker<>::alloc_stats;
+
+  private:
+    static unsigned char byte_(std::string_view key, size_t pos)
+    {
+      return static_cast<unsigned char>(key[pos]);
+    }
+    static std::string_view leaf_bytes_(const Leaf *leaf, buffer &buf)
+    {
+      return Traits::encode(leaf->data_.first, buf);
+    }
+
+    Leaf *find_leaf_(const key_type &key) const;
+    template <typename... Args>
+    std::pair<Leaf *, bool> emplace_(const key_type &key, Args &&...args);
+
+    static Base **find_child_(Inner *node, unsigned char byte);
+    // ближайший потомок с байтом строго меньше/больше byte;
+    // byte = 256 / -1 - последний/первый потомок
+    static Base *child_before_(const Inner *node, int byte);
+    static Base *child_after_(const Inner *node, int byte);
+    static Leaf *min_leaf_(Base *node);
+    static Leaf *max_leaf_(Base *node);
+    static uint32_t prefix_mismatch_(Inner *node, std::string_view key, size_t depth);
+
+    void add_child_(Base **ref, Inner *node, unsigned char byte, Base *child);
+    void remove_child_(Base **ref, Inner *node, unsigned char byte);
+    void collapse_(Base **ref, Node4 *node);
+    void cut_prefix_(Inner *node, uint32_t count, size_t depth);
+    static void copy_header_(Inner *to, const Inner *from);
+
+    void link_before_(Leaf *next, Leaf *leaf) noexcept;
+    void link_after_(Leaf *prev, Leaf *leaf) noexcept;
+    void unlink_(Leaf *leaf) noexcept;
+
+    template <typename Node, typename... Args>
+    Node *make_(Args &&...args);
+    void drop_(Base *node) noexcept;
+    void destroy_(Base *node) noexcept;
+
+    Base *root_ = nullptr;
+    Leaf *head_ = nullptr;
+    Leaf *tail_ = nullptr;
+    size_type size_ = 0;
+  };
+
+  template <typename K, typename V>
+  RadixMap<K, V>::RadixMap(std::initializer_list<value_type> init)
+  {
+    for (const auto &item : init)
+    {
+      insert(item);
+    }
+  }
+
+  template <typename K, typename V>
+  RadixMap<K, V>::RadixMap(const RadixMap &other) : alloc_stats::Tracker<>()
+  {
+    for (const auto &item : other)
+    {
+      insert(item);
+    }
+  }
+
+  template <typename K, typename V>
+  RadixMap<K, V> &RadixMap<K, V>::operator=(const RadixMap &other)
+  {
+    if (this != &other)
+    {
+      RadixMap copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  RadixMap<K, V> &RadixMap<K, V>::operator=(RadixMap &&other) noexcept
+  {
+    if (this != &other)
+    {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  V &RadixMap<K, V>::at(const key_type &key)
+  {
+    Leaf *leaf = find_leaf_(key);
+    if (leaf == nullptr)
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return leaf->data_.second;
+  }
+
+  template <typename K, typename V>
+  const V &RadixMap<K, V>::at(const key_type &key) const
+  {
+    return const_cast<RadixMap *>(this)->at(key);
+  }
+
+  template <typename K, typename V>
+  V &RadixMap<K, V>::operator[](const key_type &key)
+  {
+    return emplace_(key, key, mapped_type()).first->data_.second;
+  }
+
+  template <typename K, typename V>
+  std::pair<typename RadixMap<K, V>::iterator, bool>
+  RadixMap<K, V>::insert(const value_type &value)
+  {
+    auto result = emplace_(value.first, value);
+    return {iterator(result.first, this), result.second};
+  }
+
+  template <typename K, typename V>
+  std::pair<typename RadixMap<K, V>::iterator, bool>
+  RadixMap<K, V>::insert_or_assign(const value_type &value)
+  {
+    auto result = emplace_(value.first, value);
+    if (!result.second)
+    {
+      result.first->data_.second = value.second;
+    }
+    return {iterator(result.first, this), result.second};
+  }
+
+  template <typename K, typename V>
+  template <typename... Args>
+  std::vector<std::pair<typename RadixMap<K, V>::iterator, bool>>
+  RadixMap<K, V>::insert_many(Args &&...args)
+  {
+    std::vector<std::pair<iterator, bool>> result;
+    (result.push_back(insert(std::forward<Args>(args))), ...);
+    return result;
+  }
+
+  template <typename K, typename V>
+  typename RadixMap<K, V>::Leaf *RadixMap<K, V>::find_leaf_(const key_type &key) const
+  {
+    buffer buf;
+    std::string_view bytes = Traits::encode(key, buf);
+    Base *node = root_;
+    size_t depth = 0;
+    while (node != nullptr)
+    {
+      if (node->type_ == kLeaf)
+      {
+        Leaf *leaf = static_cast<Leaf *>(node);
+        return leaf->data_.first == key ? leaf : nullptr;
+      }
+      Inner *inner = static_cast<Inner *>(node);
+      if (inner->prefix_len_ != 0)
+      {
+        if (bytes.size() - depth < inner->prefix_len_)
+        {
+          return nullptr;
+        }
+        uint32_t stored = std::min(inner->prefix_len_, kMaxPrefix);
+        if (std::memcmp(inner->prefix_, bytes.data() + depth, stored) != 0)
+        {
+          return nullptr;
+        }
+        depth += inner->prefix_len_;
+      }
+      if (depth == bytes.size())
+      {
+        Leaf *leaf = inner->value_;
+        return leaf != nullptr && leaf->data_.first == key ? leaf : nullptr;
+      }
+      Base **child = find_child_(inner, byte_(bytes, depth));
+      if (child == nullptr)
+      {
+        return nullptr;
+      }
+      node = *child;
+      ++depth;
+    }
+    return nullptr;
+  }
+
+  // args - аргументы конструктора value_type для нового листа
+  template <typename K, typename V>
+  template <typename... Args>
+  std::pair<typename RadixMap<K, V>::Leaf *, bool>
+  RadixMap<K, V>::emplace_(const key_type &key, Args &&...args)
+  {
+    buffer buf;
+    std::string_view bytes = Traits::encode(key, buf);
+    Base **ref = &root_;
+    size_t depth = 0;
+    while (*ref != nullptr)
+    {
+      Base *node = *ref;
+      if (node->type_ == kLeaf)
+      {
+        // два листа расходятся: общий хвост - префикс нового Node4
+        Leaf *old = static_cast<Leaf *>(node);
+        if (old->data_.first == key)
+        {
+          return {old, false};
+        }
+        buffer old_buf;
+        std::string_view old_bytes = leaf_bytes_(old, old_buf);
+        size_t limit = std::min(old_bytes.size(), bytes.size());
+        size_t split = depth;
+        while (split < limit && old_bytes[split] == bytes[split])
+        {
+          ++split;
+        }
+        Leaf *leaf = make_<Leaf>(std::forward<Args>(args)...);
+        Node4 *parent = make_<Node4>();
+        parent->prefix_len_ = static_cast<uint32_t>(split - depth);
+        std::memcpy(parent->prefix_, bytes.data() + depth,
+                    std::min(parent->prefix_len_, kMaxPrefix));
+        for (Leaf *item : {old, leaf})
+        {
+          std::string_view item_bytes = item == old ? old_bytes : bytes;
+          if (item_bytes.size() == split)
+          {
+            parent->value_ = item;
+          }
+          else
+          {
+            add_child_(nullptr, parent, byte_(item_bytes, split), item);
+          }
+        }
+        *ref = parent;
+        if (bytes < old_bytes)
+        {
+          link_before_(old, leaf);
+        }
+        else
+        {
+          link_after_(old, leaf);
+        }
+        ++size_;
+        return {leaf, true};
+      }
+
+      Inner *inner = static_cast<Inner *>(node);
+      uint32_t matched = prefix_mismatch_(inner, bytes, depth);
+      if (matched < inner->prefix_len_)
+      {
+        // ключ расходится с префиксом: узел уходит под новый Node4
+        buffer any_buf;
+        std::string_view any = leaf_bytes_(min_leaf_(inner), any_buf);
+        unsigned char branch = byte_(any, depth + matched);
+        bool ends = depth + matched == bytes.size();
+        bool before = ends || byte_(bytes, depth + matched) < branch;
+        Leaf *neighbour = before ? min_leaf_(inner) : max_leaf_(inner);
+
+        Leaf *leaf = make_<Leaf>(std::forward<Args>(args)...);
+        Node4 *parent = make_<Node4>();
+        parent->prefix_len_ = matched;
+        std::memcpy(parent->prefix_, bytes.data() + depth, std::min(matched, kMaxPrefix));
+        cut_prefix_(inner, matched + 1, depth);
+        add_child_(nullptr, parent, branch, inner);
+        if (ends)
+        {
+          parent->value_ = leaf;
+        }
+        else
+        {
+          add_child_(nullptr, parent, byte_(bytes, depth + matched), leaf);
+        }
+        *ref = parent;
+        if (before)
+        {
+          link_before_(neighbour, leaf);
+        }
+        else
+        {
+          link_after_(neighbour, leaf);
+        }
+        ++size_;
+        return {leaf, true};
+      }
+      depth += inner->prefix_len_;
+
+      if (depth == bytes.size())
+      {
+        // ключ - префикс всех ключей поддерева
+        if (inner->value_ != nullptr)
+        {
+          return {inner->value_, false};
+        }
+        Leaf *next = min_leaf_(inner);
+        Leaf *leaf = make_<Leaf>(std::forward<Args>(args)...);
+        inner->value_ = leaf;
+        link_before_(next, leaf);
+        ++size_;
+        return {leaf, true};
+      }
+
+      unsigned char byte = byte_(bytes, depth);
+      Base **child = find_child_(inner, byte);
+      if (child == nullptr)
+      {
+        Base *below = child_before_(inner, byte);
+        Leaf *prev = below != nullptr ? max_leaf_(below) : inner->value_;
+        Leaf *next = prev == nullptr ? min_leaf_(child_after_(inner, byte)) : nullptr;
+        Leaf *leaf = make_<Leaf>(std::forward<Args>(args)...);
+        add_child_(ref, inner, byte, leaf);
+        if (prev != nullptr)
+        {
+          link_after_(prev, leaf);
+        }
+        else
+        {
+          link_before_(next, leaf);
+        }
+        ++size_;
+        return {leaf, true};
+      }
+      ref = child;
+      ++depth;
+    }
+
+    Leaf *leaf = make_<Leaf>(std::forward<Args>(args)...);
+    root_ = leaf;
+    head_ = tail_ = leaf;
+    ++size_;
+    return {leaf, true};
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::erase(iterator pos)
+  {
+    Leaf *leaf = pos.leaf_;
+    if (leaf == nullptr)
+    {
+      throw std::out_of_range("Erase of end() in RadixMap");
+    }
+    buffer buf;
+    std::string_view bytes = leaf_bytes_(leaf, buf);
+    Base **ref = &root_;
+    Base **parent_ref = nullptr;
+    size_t depth = 0;
+    while (*ref != leaf)
+    {
+      Inner *inner = static_cast<Inner *>(*ref);
+      depth += inner->prefix_len_;
+      if (depth == bytes.size())
+      {
+        inner->value_ = nullptr;
+        if (inner->type_ == kNode4)
+        {
+          collapse_(ref, static_cast<Node4 *>(inner));
+        }
+        break;
+      }
+      parent_ref = ref;
+      ref = find_child_(inner, byte_(bytes, depth));
+      ++depth;
+    }
+    if (*ref == leaf)
+    {
+      if (parent_ref == nullptr)
+      {
+        root_ = nullptr;
+      }
+      else
+      {
+        remove_child_(parent_ref, static_cast<Inner *>(*parent_ref),
+                      byte_(bytes, depth - 1));
+      }
+    }
+    unlink_(leaf);
+    drop_(leaf);
+    --size_;
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::clear() noexcept
+  {
+    destroy_(root_);
+    root_ = nullptr;
+    head_ = tail_ = nullptr;
+    size_ = 0;
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::swap(RadixMap &other) noexcept
+  {
+    std::swap(root_, other.root_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    swap_alloc_stats_(other);
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::merge(RadixMap &other)
+  {
+    if (this == &other)
+    {
+      return;
+    }
+    iterator it = other.begin();
+    while (it != other.end())
+    {
+      iterator next = std::next(it);
+      if (insert(*it).second)
+      {
+        other.erase(it);
+      }
+      it = next;
+    }
+  }
+
+  template <typename K, typename V>
+  std::pair<typename RadixMap<K, V>::iterator, typename RadixMap<K, V>::iterator>
+  RadixMap<K, V>::prefix_range(std::string_view prefix) const
+  {
+    Base *node = root_;
+    size_t depth = 0;
+    while (node != nullptr)
+    {
+      if (node->type_ == kLeaf)
+      {
+        Leaf *leaf = static_cast<Leaf *>(node);
+        buffer buf;
+        std::string_view bytes = leaf_bytes_(leaf, buf);
+        if (bytes.substr(0, prefix.size()) == prefix)
+        {
+          return {iterator(leaf, this), iterator(leaf->next_, this)};
+        }
+        break;
+      }
+      Inner *inner = static_cast<Inner *>(node);
+      uint32_t matched = prefix_mismatch_(inner, prefix, depth);
+      if (depth + matched == prefix.size())
+      {
+        return {iterator(min_leaf_(inner), this), iterator(max_leaf_(inner)->next_, this)};
+      }
+      if (matched < inner->prefix_len_)
+      {
+        break;
+      }
+      depth += inner->prefix_len_;
+      Base **child = find_child_(inner, byte_(prefix, depth));
+      if (child == nullptr)
+      {
+        break;
+      }
+      node = *child;
+      ++depth;
+    }
+    return {end(), end()};
+  }
+
+  template <typename K, typename V>
+  typename RadixMap<K, V>::Base **RadixMap<K, V>::find_child_(Inner *node,
+                                                               unsigned char byte)
+  {
+    switch (node->type_)
+    {
+    case kNode4:
+    {
+      Node4 *n = static_cast<Node4 *>(node);
+      for (uint16_t i = 0; i < n->count_; ++i)
+      {
+        if (n->keys_[i] == byte)
+        {
+          return &n->children_[i];
+        }
+      }
+      return nullptr;
+    }
+    case kNode16:
+    {
+      Node16 *n = static_cast<Node16 *>(node);
+#if defined(__SSE2__)
+      __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys_));
+      __m128i hits = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+      unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits)) &
+                      ((1U << n->count_) - 1);
+      return mask != 0 ? &n->children_[__builtin_ctz(mask)] : nullptr;
+#else
+      for (uint16_t i = 0; i < n->count_; ++i)
+      {
+        if (n->keys_[i] == byte)
+        {
+          return &n->children_[i];
+        }
+      }
+      return nullptr;
+#endif
+    }
+    case kNode48:
+    {
+      Node48 *n = static_cast<Node48 *>(node);
+      unsigned char slot = n->index_[byte];
+      return slot != 0 ? &n->children_[slot - 1] : nullptr;
+    }
+    default:
+    {
+      Node256 *n = static_cast<Node256 *>(node);
+      return n->children_[byte] != nullptr ? &n->children_[byte] : nullptr;
+    }
+    }
+  }
+
+  template <typename K, typename V>
+  typename RadixMap<K, V>::Base *RadixMap<K, V>::child_before_(const Inner *node, int byte)
+  {
+    switch (node->type_)
+    {
+    case kNode4:
+    case kNode16:
+    {
+      const unsigned char *keys = node->type_ == kNode4
+                                      ? static_cast<const Node4 *>(node)->keys_
+                                      : static_cast<const Node16 *>(node)->keys_;
+      Base *const *children = node->type_ == kNode4
+                                  ? static_cast<const Node4 *>(node)->children_
+                                  : static_cast<const Node16 *>(node)->children_;
+      for (int i = node->count_ - 1; i >= 0; --i)
+      {
+        if (keys[i] < byte)
+        {
+          return children[i];
+        }
+      }
+      return nullptr;
+    }
+    case kNode48:
+    {
+      const Node48 *n = static_cast<const Node48 *>(node);
+      for (int b = byte - 1; b >= 0; --b)
+      {
+        if (n->index_[b] != 0)
+        {
+          return n->children_[n->index_[b] - 1];
+        }
+      }
+      return nullptr;
+    }
+    default:
+    {
+      const Node256 *n = static_cast<const Node256 *>(node);
+      for (int b = byte - 1; b >= 0; --b)
+      {
+        if (n->children_[b] != nullptr)
+        {
+          return n->children_[b];
+        }
+      }
+      return nullptr;
+    }
+    }
+  }
+
+  template <typename K, typename V>
+  typename RadixMap<K, V>::Base *RadixMap<K, V>::child_after_(const Inner *node, int byte)
+  {
+    switch (node->type_)
+    {
+    case kNode4:
+    case kNode16:
+    {
+      const unsigned char *keys = node->type_ == kNode4
+                                      ? static_cast<const Node4 *>(node)->keys_
+                                      : static_cast<const Node16 *>(node)->keys_;
+      Base *const *children = node->type_ == kNode4
+                                  ? static_cast<const Node4 *>(node)->children_
+                                  : static_cast<const Node16 *>(node)->children_;
+      for (int i = 0; i < node->count_; ++i)
+      {
+        if (keys[i] > byte)
+        {
+          return children[i];
+        }
+      }
+      return nullptr;
+    }
+    case kNode48:
+    {
+      const Node48 *n = static_cast<const Node48 *>(node);
+      for (int b = byte + 1; b < 256; ++b)
+      {
+        if (n->index_[b] != 0)
+        {
+          return n->children_[n->index_[b] - 1];
+        }
+      }
+      return nullptr;
+    }
+    default:
+    {
+      const Node256 *n = static_cast<const Node256 *>(node);
+      for (int b = byte + 1; b < 256; ++b)
+      {
+        if (n->children_[b] != nullptr)
+        {
+          return n->children_[b];
+        }
+      }
+      return nullptr;
+    }
+    }
+  }
+
+  template <typename K, typename V>
+  typename RadixMap<K, V>::Leaf *RadixMap<K, V>::min_leaf_(Base *node)
+  {
+    while (node->type_ != kLeaf)
+    {
+      Inner *inner = static_cast<Inner *>(node);
+      if (inner->value_ != nullptr)
+      {
+        return inner->value_;
+      }
+      node = child_after_(inner, -1);
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  template <typename K, typename V>
+  typename RadixMap<K, V>::Leaf *RadixMap<K, V>::max_leaf_(Base *node)
+  {
+    while (node->type_ != kLeaf)
+    {
+      Inner *inner = static_cast<Inner *>(node);
+      Base *last = child_before_(inner, 256);
+      if (last == nullptr)
+      {
+        return inner->value_;
+      }
+      node = last;
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  // сколько байт префикса узла совпало с key начиная с depth
+  // (не больше, чем осталось в key); байты сверх kMaxPrefix берутся
+  // из листа поддерева
+  template <typename K, typename V>
+  uint32_t RadixMap<K, V>::prefix_mismatch_(Inner *node, std::string_view key, size_t depth)
+  {
+    uint32_t limit = static_cast<uint32_t>(
+        std::min<size_t>(node->prefix_len_, key.size() - depth));
+    uint32_t stored = std::min(limit, kMaxPrefix);
+    uint32_t i = 0;
+    for (; i < stored; ++i)
+    {
+      if (node->prefix_[i] != byte_(key, depth + i))
+      {
+        return i;
+      }
+    }
+    if (i < limit)
+    {
+      buffer buf;
+      std::string_view any = leaf_bytes_(min_leaf_(node), buf);
+      for (; i < limit; ++i)
+      {
+        if (any[depth + i] != key[depth + i])
+        {
+          return i;
+        }
+      }
+    }
+    return limit;
+  }
+
+  // отрезает первые count байт префикса узла, стоящего на глубине depth
+  template <typename K, typename V>
+  void RadixMap<K, V>::cut_prefix_(Inner *node, uint32_t count, size_t depth)
+  {
+    uint32_t rest = node->prefix_len_ - count;
+    if (node->prefix_len_ <= kMaxPrefix)
+    {
+      std::memmove(node->prefix_, node->prefix_ + count, rest);
+    }
+    else
+    {
+      buffer buf;
+      std::string_view any = leaf_bytes_(min_leaf_(node), buf);
+      std::memcpy(node->prefix_, any.data() + depth + count, std::min(rest, kMaxPrefix));
+    }
+    node->prefix_len_ = rest;
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::copy_header_(Inner *to, const Inner *from)
+  {
+    to->count_ = from->count_;
+    to->prefix_len_ = from->prefix_len_;
+    std::memcpy(to->prefix_, from->prefix_, kMaxPrefix);
+    to->value_ = from->value_;
+  }
+
+  // ref = nullptr - узел только что создан и заведомо не переполнен
+  template <typename K, typename V>
+  void RadixMap<K, V>::add_child_(Base **ref, Inner *node, unsigned char byte, Base *child)
+  {
+    switch (node->type_)
+    {
+    case kNode4:
+    {
+      Node4 *n = static_cast<Node4 *>(node);
+      if (n->count_ < 4)
+      {
+        int pos = n->count_;
+        while (pos > 0 && n->keys_[pos - 1] > byte)
+        {
+          n->keys_[pos] = n->keys_[pos - 1];
+          n->children_[pos] = n->children_[pos - 1];
+          --pos;
+        }
+        n->keys_[pos] = byte;
+        n->children_[pos] = child;
+        ++n->count_;
+        return;
+      }
+      Node16 *grown = make_<Node16>();
+      copy_header_(grown, n);
+      std::memcpy(grown->keys_, n->keys_, 4);
+      std::memcpy(grown->children_, n->children_, 4 * sizeof(Base *));
+      *ref = grown;
+      drop_(n);
+      add_child_(ref, grown, byte, child);
+      return;
+    }
+    case kNode16:
+    {
+      Node16 *n = static_cast<Node16 *>(node);
+      if (n->count_ < 16)
+      {
+        int pos = n->count_;
+        while (pos > 0 && n->keys_[pos - 1] > byte)
+        {
+          n->keys_[pos] = n->keys_[pos - 1];
+          n->children_[pos] = n->children_[pos - 1];
+          --pos;
+        }
+        n->keys_[pos] = byte;
+        n->children_[pos] = child;
+        ++n->count_;
+        return;
+      }
+      Node48 *grown = make_<Node48>();
+      copy_header_(grown, n);
+      for (int i = 0; i < 16; ++i)
+      {
+        grown->index_[n->keys_[i]] = static_cast<unsigned char>(i + 1);
+        grown->children_[i] = n->children_[i];
+      }
+      *ref = grown;
+      drop_(n);
+      add_child_(ref, grown, byte, child);
+      return;
+    }
+    case kNode48:
+    {
+      Node48 *n = static_cast<Node48 *>(node);
+      if (n->count_ < 48)
+      {
+        int slot = 0;
+        while (n->children_[slot] != nullptr)
+        {
+          ++slot;
+        }
+        n->children_[slot] = child;
+        n->index_[byte] = static_cast<unsigned char>(slot + 1);
+        ++n->count_;
+        return;
+      }
+      Node256 *grown = make_<Node256>();
+      copy_header_(grown, n);
+      for (int b = 0; b < 256; ++b)
+      {
+        if (n->index_[b] != 0)
+        {
+          grown->children_[b] = n->children_[n->index_[b] - 1];
+        }
+      }
+      *ref = grown;
+      drop_(n);
+      add_child_(ref, grown, byte, child);
+      return;
+    }
+    default:
+    {
+      Node256 *n = static_cast<Node256 *>(node);
+      n->children_[byte] = child;
+      ++n->count_;
+    }
+    }
+  }
+
+  // узел сжимается, когда дети помещаются в меньший тип с запасом
+  template <typename K, typename V>
+  void RadixMap<K, V>::remove_child_(Base **ref, Inner *node, unsigned char byte)
+  {
+    switch (node->type_)
+    {
+    case kNode4:
+    case kNode16:
+    {
+      unsigned char *keys = node->type_ == kNode4 ? static_cast<Node4 *>(node)->keys_
+                                                  : static_cast<Node16 *>(node)->keys_;
+      Base **children = node->type_ == kNode4 ? static_cast<Node4 *>(node)->children_
+                                              : static_cast<Node16 *>(node)->children_;
+      int pos = 0;
+      while (keys[pos] != byte)
+      {
+        ++pos;
+      }
+      for (int i = pos + 1; i < node->count_; ++i)
+      {
+        keys[i - 1] = keys[i];
+        children[i - 1] = children[i];
+      }
+      --node->count_;
+      if (node->type_ == kNode4)
+      {
+        collapse_(ref, static_cast<Node4 *>(node));
+      }
+      else if (node->count_ == 3)
+      {
+        Node4 *shrunk = make_<Node4>();
+        copy_header_(shrunk, node);
+        std::memcpy(shrunk->keys_, keys, 3);
+        std::memcpy(shrunk->children_, children, 3 * sizeof(Base *));
+        *ref = shrunk;
+        drop_(node);
+      }
+      return;
+    }
+    case kNode48:
+    {
+      Node48 *n = static_cast<Node48 *>(node);
+      n->children_[n->index_[byte] - 1] = nullptr;
+      n->index_[byte] = 0;
+      --n->count_;
+      if (n->count_ == 12)
+      {
+        Node16 *shrunk = make_<Node16>();
+        copy_header_(shrunk, n);
+        int pos = 0;
+        for (int b = 0; b < 256; ++b)
+        {
+          if (n->index_[b] != 0)
+          {
+            shrunk->keys_[pos] = static_cast<unsigned char>(b);
+            shrunk->children_[pos] = n->children_[n->index_[b] - 1];
+            ++pos;
+          }
+        }
+        *ref = shrunk;
+        drop_(n);
+      }
+      return;
+    }
+    default:
+    {
+      Node256 *n = static_cast<Node256 *>(node);
+      n->children_[byte] = nullptr;
+      --n->count_;
+      if (n->count_ == 37)
+      {
+        Node48 *shrunk = make_<Node48>();
+        copy_header_(shrunk, n);
+        int slot = 0;
+        for (int b = 0; b < 256; ++b)
+        {
+          if (n->children_[b] != nullptr)
+          {
+            shrunk->children_[slot] = n->children_[b];
+            shrunk->index_[b] = static_cast<unsigned char>(++slot);
+          }
+        }
+        *ref = shrunk;
+        drop_(n);
+      }
+    }
+    }
+  }
+
+  // у внутреннего узла должно быть хотя бы два входа (дети и value_);
+  // узел с одним входом заменяется им, префиксы склеиваются
+  template <typename K, typename V>
+  void RadixMap<K, V>::collapse_(Base **ref, Node4 *node)
+  {
+    int entries = node->count_ + (node->value_ != nullptr ? 1 : 0);
+    if (entries > 1)
+    {
+      return;
+    }
+    if (node->count_ == 0)
+    {
+      *ref = node->value_;
+      drop_(node);
+      return;
+    }
+    Base *child = node->children_[0];
+    if (child->type_ != kLeaf)
+    {
+      Inner *inner = static_cast<Inner *>(child);
+      unsigned char merged[kMaxPrefix];
+      uint32_t len = std::min(node->prefix_len_, kMaxPrefix);
+      std::memcpy(merged, node->prefix_, len);
+      if (len < kMaxPrefix)
+      {
+        merged[len++] = node->keys_[0];
+      }
+      uint32_t tail = std::min(kMaxPrefix - len, std::min(inner->prefix_len_, kMaxPrefix));
+      std::memcpy(merged + len, inner->prefix_, tail);
+      std::memcpy(inner->prefix_, merged, len + tail);
+      inner->prefix_len_ += node->prefix_len_ + 1;
+    }
+    *ref = child;
+    drop_(node);
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::link_before_(Leaf *next, Leaf *leaf) noexcept
+  {
+    leaf->next_ = next;
+    leaf->prev_ = next->prev_;
+    if (next->prev_ != nullptr)
+    {
+      next->prev_->next_ = leaf;
+    }
+    else
+    {
+      head_ = leaf;
+    }
+    next->prev_ = leaf;
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::link_after_(Leaf *prev, Leaf *leaf) noexcept
+  {
+    leaf->prev_ = prev;
+    leaf->next_ = prev->next_;
+    if (prev->next_ != nullptr)
+    {
+      prev->next_->prev_ = leaf;
+    }
+    else
+    {
+      tail_ = leaf;
+    }
+    prev->next_ = leaf;
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::unlink_(Leaf *leaf) noexcept
+  {
+    (leaf->prev_ != nullptr ? leaf->prev_->next_ : head_) = leaf->next_;
+    (leaf->next_ != nullptr ? leaf->next_->prev_ : tail_) = leaf->prev_;
+  }
+
+  template <typename K, typename V>
+  template <typename Node, typename... Args>
+  Node *RadixMap<K, V>::make_(Args &&...args)
+  {
+    Node *node = new Node(std::forward<Args>(args)...);
+    on_allocate_(alloc_stats::Source::kTree, sizeof(Node));
+    return node;
+  }
+
+  template <typename K, typename V>
+  void RadixMap<K, V>::drop_(Base *node) noexcept
+  {
+    switch (node->type_)
+    {
+    case kLeaf:
+      on_free_(alloc_stats::Source::kTree, sizeof(Leaf));
+      delete static_cast<Leaf *>(node);
+      break;
+    case kNode4:
+      on_free_(alloc_stats::Source::kTree, sizeof(Node4));
+      delete static_cast<Node4 *>(node);
+      break;
+    case kNode16:
+      on_free_(alloc_stats::Source::kTree, sizeof(Node16));
+      delete static_cast<Node16 *>(node);
+      break;
+    case kNode48:
+      on_free_(alloc_stats::Source::kTree, sizeof(Node48));
+      delete static_cast<Node48 *>(node);
+      break;
+    default:
+      on_free_(alloc_stats::Source::kTree, sizeof(Node256));
+      delete static_cast<Node256 *>(node);
+    }
+  }
+
+  // глубина рекурсии не больше длины ключа
+  template <typename K, typename V>
+  void RadixMap<K, V>::destroy_(Base *node) noexcept
+  {
+    if (node == nullptr)
+    {
+      return;
+    }
+    switch (node->type_)
+    {
+    case kNode4:
+    case kNode16:
+    {
+      Inner *inner = static_cast<Inner *>(node);
+      Base **children = node->type_ == kNode4 ? static_cast<Node4 *>(node)->children_
+                                              : static_cast<Node16 *>(node)->children_;
+      for (int i = 0; i < inner->count_; ++i)
+      {
+        destroy_(children[i]);
+      }
+      destroy_(inner->value_);
+      break;
+    }
+    case kNode48:
+      for (Base *child : static_cast<Node48 *>(node)->children_)
+      {
+        destroy_(child);
+      }
+      destroy_(static_cast<Inner *>(node)->value_);
+      break;
+    case kNode256:
+      for (Base *child : static_cast<Node256 *>(node)->children_)
+      {
+        destroy_(child);
+      }
+      destroy_(static_cast<Inner *>(node)->value_);
+      break;
+    default:
+      break;
+    }
+    drop_(node);
+  }
+}
+
+#endif // S21_RADIX_MAP_H
@@ -0,0 +1,268 @@
+#ifndef S21_CONCURRENT_VECTOR_H
+#define S21_CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_config.h"
+
+namespace s21
+{
+    // Вектор только для добавления, общий для нескольких потоков.
+    // push_back/emplace_back без блокировок: индекс занимается одним
+    // fetch_add, элемент конструируется на месте и публикуется флагом.
+    // Память - сегменты, растущие вдвое: сегмент b хранит
+    // kFirstSegment << b элементов и не перемещается, поэтому ссылки и
+    // индексы стабильны. Читать можно опубликованные элементы
+    // параллельно с добавлением; clear, reserve и разрушение требуют,
+    // чтобы других потоков не было.
+    template <typename T>
+    class ConcurrentVector
+    {
+    public:
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+
+        static constexpr size_type kFirstSegment = 32;
+
+        ConcurrentVector() = default;
+        ConcurrentVector(const ConcurrentVector &) = delete;
+        ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+        ~ConcurrentVector();
+
+        // возвращают индекс нового элемента
+        size_type push_back(const_reference value) { return emplace_back(value); }
+        size_type push_back(value_type &&value) { return emplace_back(std::move(value)); }
+        template <typename... Args>
+        size_type emplace_back(Args &&...args);
+
+        // элемент pos должен быть опубликован (published(pos))
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        // бросает std::out_of_range, если элемент ещё не опубликован
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        bool published(size_type pos) const;
+
+        // число занятых индексов, включая ещё конструируемые
+        size_type size() const { return size_.load(std::memory_order_acquire); }
+        bool empty() const { return size() == 0; }
+        size_type capacity() const;
+        void reserve(size_type new_capacity);
+        void clear();
+
+        // f(index, element) для опубликованных элементов по порядку
+        template <typename F>
+        void for_each(F f) const;
+
+    private:
+        struct Slot
+        {
+            alignas(T) unsigned char storage[sizeof(T)];
+            std::atomic<bool> ready;
+
+            T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+        };
+
+        static constexpr size_type kFirstShift = 5;
+        static constexpr size_type kSegments = sizeof(size_type) * 8 - kFirstShift;
+        static_assert(kFirstSegment == size_type(1) << kFirstShift);
+
+        static size_type segment_of_(size_type pos)
+        {
+            return sizeof(unsigned long long) * 8 - 1 -
+                   __builtin_clzll(static_cast<unsigned long long>(pos + kFirstSegment)) -
+                   kFirstShift;
+        }
+        static size_type segment_size_(size_type segment) { return kFirstSegment << segment; }
+        static size_type offset_of_(size_type pos, size_type segment)
+        {
+            return pos + kFirstSegment - segment_size_(segment);
+        }
+
+        Slot *slot_(size_type pos) const;
+        Slot *segment_(size_type segment);
+        Slot *checked_slot_(size_type pos) const;
+        void release_();
+
+        std::atomic<Slot *> segments_[kSegments] = {};
+        std::atomic<size_type> size_{0};
+    };
+
+    template <typename T>
+    ConcurrentVector<T>::~ConcurrentVector()
+    {
+        release_();
+    }
+
+    template <typename T>
+    template <typename... Args>
+    typename ConcurrentVector<T>::size_type ConcurrentVector<T>::emplace_back(Args &&...args)
+    {
+        size_type pos = size_.fetch_add(1, std::memory_order_acq_rel);
+        size_type segment = segment_of_(pos);
+        if (segment >= kSegments)
+        {
+            throw std::length_error("ConcurrentVector is full");
+        }
+        Slot &slot = segment_(segment)[offset_of_(pos, segment)];
+        // если конструктор бросит исключение, индекс останется
+        // неопубликованной дырой
+        ::new (static_cast<void *>(slot.storage)) T(std::forward<Args>(args)...);
+        slot.ready.store(true, std::memory_order_release);
+        return pos;
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::reference ConcurrentVector<T>::operator[](size_type pos)
+    {
+        DefaultBoundsCheck::check(pos, size());
+        return *slot_(pos)->value();
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::const_reference
+    ConcurrentVector<T>::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, size());
+        return *slot_(pos)->value();
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::reference ConcurrentVector<T>::at(size_type pos)
+    {
+        return *checked_slot_(pos)->value();
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::const_reference ConcurrentVector<T>::at(size_type pos) const
+    {
+        return *checked_slot_(pos)->value();
+    }
+
+    template <typename T>
+    bool ConcurrentVector<T>::published(size_type pos) const
+    {
+        if (pos >= size())
+        {
+            return false;
+        }
+        size_type segment = segment_of_(pos);
+        Slot *base = segments_[segment].load(std::memory_order_acquire);
+        return base && base[offset_of_(pos, segment)].ready.load(std::memory_order_acquire);
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::size_type ConcurrentVector<T>::capacity() const
+    {
+        size_type result = 0;
+        for (size_type s = 0; s < kSegments && segments_[s].load(std::memory_order_acquire); ++s)
+        {
+            result += segment_size_(s);
+        }
+        return result;
+    }
+
+    template <typename T>
+    void ConcurrentVector<T>::reserve(size_type new_capacity)
+    {
+        for (size_type s = 0; s < kSegments && capacity() < new_capacity; ++s)
+        {
+            segment_(s);
+        }
+    }
+
+    template <typename T>
+    void ConcurrentVector<T>::clear()
+    {
+        release_();
+    }
+
+    template <typename T>
+    template <typename F>
+    void ConcurrentVector<T>::for_each(F f) const
+    {
+        size_type n = size();
+        for (size_type pos = 0; pos < n; ++pos)
+        {
+            if (published(pos))
+            {
+                f(pos, static_cast<const_reference>(*slot_(pos)->value()));
+            }
+        }
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::Slot *ConcurrentVector<T>::slot_(size_type pos) const
+    {
+        size_type segment = segment_of_(pos);
+        return segments_[segment].load(std::memory_order_acquire) + offset_of_(pos, segment);
+    }
+
+    // сегмент выделяет первый поток, которому он понадобился;
+    // проигравшие гонку освобождают свою копию
+    template <typename T>
+    typename ConcurrentVector<T>::Slot *ConcurrentVector<T>::segment_(size_type segment)
+    {
+        Slot *base = segments_[segment].load(std::memory_order_acquire);
+        if (base)
+        {
+            return base;
+        }
+        size_type n = segment_size_(segment);
+        Slot *fresh = std::allocator<Slot>().allocate(n);
+        for (size_type i = 0; i < n; ++i)
+        {
+            ::new (static_cast<void *>(&fresh[i].ready)) std::atomic<bool>(false);
+        }
+        if (segments_[segment].compare_exchange_strong(base, fresh, std::memory_order_acq_rel))
+        {
+            return fresh;
+        }
+        std::allocator<Slot>().deallocate(fresh, n);
+        return base;
+    }
+
+    template <typename T>
+    typename ConcurrentVector<T>::Slot *ConcurrentVector<T>::checked_slot_(size_type pos) const
+    {
+        if (!published(pos))
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return slot_(pos);
+    }
+
+    template <typename T>
+    void ConcurrentVector<T>::release_()
+    {
+        size_type n = size_.load(std::memory_order_acquire);
+        for (size_type s = 0; s < kSegments; ++s)
+        {
+            Slot *base = segments_[s].load(std::memory_order_acquire);
+            if (!base)
+            {
+                continue;
+            }
+            size_type first = segment_size_(s) - kFirstSegment;
+            for (size_type i = 0; i < segment_size_(s) && first + i < n; ++i)
+            {
+                if (base[i].ready.load(std::memory_order_relaxed))
+                {
+                    std::destroy_at(base[i].value());
+                }
+            }
+            std::allocator<Slot>().deallocate(base, segment_size_(s));
+            segments_[s].store(nullptr, std::memory_order_relaxed);
+        }
+        size_.store(0, std::memory_order_release);
+    }
+}
+
+#endif // S21_CONCURRENT_VECTOR_H
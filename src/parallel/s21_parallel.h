@@ -0,0 +1,270 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_thread_pool.h"
+
+namespace s21
+{
+    // Параллельные алгоритмы над диапазонами с произвольным доступом
+    // (в первую очередь Vector). grain - минимальный размер куска, который
+    // обрабатывается одной задачей; по умолчанию kDefaultGrain элементов.
+    inline constexpr size_t kDefaultGrain = size_t(1) << 14;
+
+    namespace parallel_detail
+    {
+        template <typename It>
+        using if_random_access = std::enable_if_t<std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<It>::iterator_category>>;
+
+        // разбить [0, n) на куски не меньше grain и вызвать f(lo, hi)
+        // для каждого в пуле
+        template <typename F>
+        void for_each_chunk(size_t n, size_t grain, ThreadPool &pool, F &&f)
+        {
+            grain = std::max<size_t>(grain, 1);
+            size_t chunks = std::min((n + grain - 1) / grain, pool.size() * 4);
+            if (chunks <= 1)
+            {
+                if (n)
+                {
+                    f(size_t(0), n);
+                }
+                return;
+            }
+            size_t step = (n + chunks - 1) / chunks;
+            TaskGroup group(pool);
+            for (size_t lo = step; lo < n; lo += step)
+            {
+                size_t hi = std::min(lo + step, n);
+                group.run([&f, lo, hi]
+                          { f(lo, hi); });
+            }
+            f(size_t(0), std::min(step, n));
+            group.wait();
+        }
+
+        // разрушает n сконструированных элементов сырого буфера
+        template <typename T>
+        struct DestroyGuard
+        {
+            T *first;
+            size_t n;
+            ~DestroyGuard() { std::destroy(first, first + n); }
+        };
+
+        // сколько элементов a[0, na) попадает в первые d элементов
+        // устойчивого слияния a и b
+        template <typename It, typename Compare>
+        size_t co_rank(size_t d, It a, size_t na, It b, size_t nb, Compare &comp)
+        {
+            size_t lo = d > nb ? d - nb : 0;
+            size_t hi = std::min(d, na);
+            while (lo < hi)
+            {
+                size_t i = lo + (hi - lo) / 2;
+                size_t j = d - i - 1;
+                if (comp(b[j], a[i]))
+                {
+                    hi = i;
+                }
+                else
+                {
+                    lo = i + 1;
+                }
+            }
+            return lo;
+        }
+
+        // слить соседние отсортированные серии ширины width из src в dst,
+        // разрезая каждое слияние на куски около grain элементов
+        template <typename It, typename Out, typename Compare>
+        void merge_pass(It src, Out dst, size_t n, size_t width, size_t grain,
+                        Compare &comp, ThreadPool &pool)
+        {
+            TaskGroup group(pool);
+            for (size_t start = 0; start < n; start += 2 * width)
+            {
+                size_t mid = std::min(start + width, n);
+                size_t end = std::min(start + 2 * width, n);
+                It a = src + start;
+                It b = src + mid;
+                size_t na = mid - start;
+                size_t nb = end - mid;
+                for (size_t d0 = 0; d0 < na + nb; d0 += grain)
+                {
+                    size_t d1 = std::min(d0 + grain, na + nb);
+                    group.run([=, &comp]
+                              {
+                        size_t i0 = co_rank(d0, a, na, b, nb, comp);
+                        size_t i1 = co_rank(d1, a, na, b, nb, comp);
+                        std::merge(std::make_move_iterator(a + i0),
+                                   std::make_move_iterator(a + i1),
+                                   std::make_move_iterator(b + (d0 - i0)),
+                                   std::make_move_iterator(b + (d1 - i1)),
+                                   dst + start + d0, comp); });
+                }
+            }
+            group.wait();
+        }
+    }
+
+    // f(element) для каждого элемента [first, last)
+    template <typename It, typename F,
+              typename = parallel_detail::if_random_access<It>>
+    void parallel_for(It first, It last, F f, size_t grain = kDefaultGrain,
+                      ThreadPool &pool = ThreadPool::global())
+    {
+        parallel_detail::for_each_chunk(
+            last - first, grain, pool, [first, &f](size_t lo, size_t hi)
+            { std::for_each(first + lo, first + hi, f); });
+    }
+
+    // out[i] = f(first[i])
+    template <typename It, typename Out, typename F,
+              typename = parallel_detail::if_random_access<It>>
+    Out parallel_transform(It first, It last, Out out, F f,
+                           size_t grain = kDefaultGrain,
+                           ThreadPool &pool = ThreadPool::global())
+    {
+        parallel_detail::for_each_chunk(
+            last - first, grain, pool, [first, out, &f](size_t lo, size_t hi)
+            { std::transform(first + lo, first + hi, out + lo, f); });
+        return out + (last - first);
+    }
+
+    // свёртка ассоциативной операцией op; куски сворачиваются
+    // параллельно, частичные результаты - по порядку слева направо
+    template <typename It, typename R, typename Op,
+              typename = parallel_detail::if_random_access<It>>
+    R parallel_reduce(It first, It last, R init, Op op,
+                      size_t grain = kDefaultGrain,
+                      ThreadPool &pool = ThreadPool::global())
+    {
+        size_t n = last - first;
+        if (n == 0)
+        {
+            return init;
+        }
+        grain = std::max<size_t>(grain, 1);
+        size_t chunks = std::max<size_t>(
+            std::min((n + grain - 1) / grain, pool.size() * 4), 1);
+        size_t step = (n + chunks - 1) / chunks;
+        std::vector<R> partial;
+        for (size_t lo = 0; lo < n; lo += step)
+        {
+            partial.push_back(R(first[lo]));
+        }
+        parallel_detail::for_each_chunk(
+            partial.size(), 1, pool, [&](size_t c_lo, size_t c_hi)
+            {
+                for (size_t c = c_lo; c < c_hi; ++c)
+                {
+                    size_t hi = std::min((c + 1) * step, n);
+                    for (size_t i = c * step + 1; i < hi; ++i)
+                    {
+                        partial[c] = op(std::move(partial[c]), first[i]);
+                    }
+                } });
+        for (R &value : partial)
+        {
+            init = op(std::move(init), std::move(value));
+        }
+        return init;
+    }
+
+    // устойчивая сортировка: куски сортируются параллельно, затем
+    // сливаются попарно параллельными проходами через буфер. Буфер -
+    // сырая ёмкость Vector, заполняемая перемещением из v, так что
+    // конструктор по умолчанию у T не нужен
+    template <typename T, typename G, typename M, typename Compare = std::less<>>
+    void parallel_sort(Vector<T, G, M> &v, Compare comp = Compare(),
+                       size_t grain = kDefaultGrain,
+                       ThreadPool &pool = ThreadPool::global())
+    {
+        size_t n = v.size();
+        grain = std::max<size_t>(grain, 2);
+        if (n <= grain || pool.size() == 1)
+        {
+            std::stable_sort(v.begin(), v.end(), comp);
+            return;
+        }
+        size_t width = std::max(grain, (n + pool.size() * 4 - 1) / (pool.size() * 4));
+        T *data = v.data();
+
+        Vector<T, G, M> buffer;
+        buffer.reserve(n);
+        T *scratch = buffer.data();
+        parallel_detail::for_each_chunk(n, grain, pool, [&](size_t lo, size_t hi)
+                                        { std::uninitialized_move(data + lo, data + hi, scratch + lo); });
+        parallel_detail::DestroyGuard<T> guard{scratch, n};
+
+        // куски сортируются там, откуда после всех проходов слияния
+        // результат окажется в v
+        size_t passes = 0;
+        for (size_t w = width; w < n; w *= 2)
+        {
+            ++passes;
+        }
+        T *src = passes % 2 ? scratch : data;
+        T *dst = passes % 2 ? data : scratch;
+        parallel_detail::for_each_chunk(
+            (n + width - 1) / width, 1, pool, [&](size_t lo, size_t hi)
+            {
+                for (size_t c = lo; c < hi; ++c)
+                {
+                    size_t first = c * width;
+                    size_t last = std::min((c + 1) * width, n);
+                    if (src == data)
+                    {
+                        std::move(scratch + first, scratch + last, data + first);
+                    }
+                    std::stable_sort(src + first, src + last, comp);
+                } });
+
+        for (; width < n; width *= 2)
+        {
+            parallel_detail::merge_pass(src, dst, n, width, grain, comp, pool);
+            std::swap(src, dst);
+        }
+    }
+
+    template <typename T, typename G, typename M, typename F>
+    void parallel_for(Vector<T, G, M> &v, F f, size_t grain = kDefaultGrain,
+                      ThreadPool &pool = ThreadPool::global())
+    {
+        parallel_for(v.begin(), v.end(), std::move(f), grain, pool);
+    }
+
+    // результат пишется в out, размер out подгоняется под v
+    template <typename T, typename G, typename M, typename U, typename G2,
+              typename M2, typename F>
+    void parallel_transform(const Vector<T, G, M> &v, Vector<U, G2, M2> &out, F f,
+                            size_t grain = kDefaultGrain,
+                            ThreadPool &pool = ThreadPool::global())
+    {
+        out.resize(v.size());
+        parallel_transform(v.data(), v.data() + v.size(), out.data(), std::move(f),
+                           grain, pool);
+    }
+
+    template <typename T, typename G, typename M, typename R, typename Op = std::plus<>>
+    R parallel_reduce(const Vector<T, G, M> &v, R init, Op op = Op(),
+                      size_t grain = kDefaultGrain,
+                      ThreadPool &pool = ThreadPool::global())
+    {
+        return parallel_reduce(v.data(), v.data() + v.size(), std::move(init),
+                               std::move(op), grain, pool);
+    }
+}
+
+#endif // S21_PARALLEL_H
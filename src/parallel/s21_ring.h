@@ -0,0 +1,381 @@
+#ifndef S21_RING_H
+#define S21_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21
+{
+    // Ограниченные неблокирующие очереди для передачи данных между
+    // потоками. Ёмкость округляется вверх до степени двойки и не
+    // меняется. Индексы производителя и потребителя лежат в разных
+    // кэш-линиях, чтобы потоки не делили одну линию.
+    inline constexpr size_t kCacheLine = 64;
+
+    namespace ring_detail
+    {
+        inline size_t round_capacity(size_t capacity)
+        {
+            if (capacity == 0 || capacity > (size_t(1) << (sizeof(size_t) * 8 - 2)))
+            {
+                throw std::length_error("Ring capacity out of range");
+            }
+            size_t rounded = 1;
+            while (rounded < capacity)
+            {
+                rounded *= 2;
+            }
+            return rounded;
+        }
+    }
+
+    // Один производитель, один потребитель. Каждая сторона хранит
+    // копию чужого индекса и перечитывает атомарный индекс только
+    // когда копия говорит, что очередь полна (пуста).
+    template <typename T>
+    class SpscRing
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T> &&
+                          std::is_nothrow_destructible_v<T>,
+                      "SpscRing requires nothrow move and destruction");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+
+        explicit SpscRing(size_type capacity);
+        SpscRing(const SpscRing &) = delete;
+        SpscRing &operator=(const SpscRing &) = delete;
+        ~SpscRing();
+
+        // сторона производителя
+        bool try_push(const T &value) { return try_emplace(value); }
+        bool try_push(T &&value) { return try_emplace(std::move(value)); }
+        template <typename... Args>
+        bool try_emplace(Args &&...args);
+        // переносит до n элементов из first, возвращает сколько записано
+        template <typename It>
+        size_type push_batch(It first, size_type n);
+
+        // сторона потребителя
+        bool try_pop(T &out);
+        // переносит до n элементов в out, возвращает сколько прочитано
+        template <typename Out>
+        size_type pop_batch(Out out, size_type n);
+
+        // приблизительные значения, пока другие потоки работают
+        size_type size() const;
+        bool empty() const { return size() == 0; }
+        size_type capacity() const { return mask_ + 1; }
+
+    private:
+        T *slot_(size_type pos) const { return buffer_ + (pos & mask_); }
+
+        T *buffer_;
+        size_type mask_;
+
+        alignas(kCacheLine) std::atomic<size_type> tail_{0};
+        size_type head_cache_ = 0;
+        alignas(kCacheLine) std::atomic<size_type> head_{0};
+        size_type tail_cache_ = 0;
+    };
+
+    template <typename T>
+    SpscRing<T>::SpscRing(size_type capacity)
+        : buffer_(nullptr), mask_(ring_detail::round_capacity(capacity) - 1)
+    {
+        buffer_ = std::allocator<T>().allocate(mask_ + 1);
+    }
+
+    template <typename T>
+    SpscRing<T>::~SpscRing()
+    {
+        size_type tail = tail_.load(std::memory_order_relaxed);
+        for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+        {
+            std::destroy_at(slot_(i));
+        }
+        std::allocator<T>().deallocate(buffer_, mask_ + 1);
+    }
+
+    template <typename T>
+    template <typename... Args>
+    bool SpscRing<T>::try_emplace(Args &&...args)
+    {
+        size_type tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ > mask_)
+        {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ > mask_)
+            {
+                return false;
+            }
+        }
+        ::new (static_cast<void *>(slot_(tail))) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T>
+    template <typename It>
+    typename SpscRing<T>::size_type SpscRing<T>::push_batch(It first, size_type n)
+    {
+        static_assert(std::is_nothrow_constructible_v<T, decltype(std::move(*first))>,
+                      "push_batch requires nothrow construction from *first");
+        size_type tail = tail_.load(std::memory_order_relaxed);
+        if (mask_ + 1 - (tail - head_cache_) < n)
+        {
+            head_cache_ = head_.load(std::memory_order_acquire);
+        }
+        n = std::min(n, mask_ + 1 - (tail - head_cache_));
+        for (size_type i = 0; i < n; ++i, ++first)
+        {
+            ::new (static_cast<void *>(slot_(tail + i))) T(std::move(*first));
+        }
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    template <typename T>
+    bool SpscRing<T>::try_pop(T &out)
+    {
+        size_type head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_)
+        {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_)
+            {
+                return false;
+            }
+        }
+        T *p = slot_(head);
+        out = std::move(*p);
+        std::destroy_at(p);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T>
+    template <typename Out>
+    typename SpscRing<T>::size_type SpscRing<T>::pop_batch(Out out, size_type n)
+    {
+        size_type head = head_.load(std::memory_order_relaxed);
+        if (tail_cache_ - head < n)
+        {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+        }
+        n = std::min(n, tail_cache_ - head);
+        for (size_type i = 0; i < n; ++i, ++out)
+        {
+            T *p = slot_(head + i);
+            *out = std::move(*p);
+            std::destroy_at(p);
+        }
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    template <typename T>
+    typename SpscRing<T>::size_type SpscRing<T>::size() const
+    {
+        size_type head = head_.load(std::memory_order_acquire);
+        size_type tail = tail_.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    // Много производителей и потребителей (схема Вьюкова): у каждой
+    // ячейки есть номер seq. Ячейка с seq == pos свободна для записи
+    // позиции pos, с seq == pos + 1 - хранит её значение. Пакетные
+    // операции занимают сразу несколько подряд готовых ячеек одним CAS.
+    template <typename T>
+    class MpmcRing
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T> &&
+                          std::is_nothrow_destructible_v<T>,
+                      "MpmcRing requires nothrow move and destruction");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+
+        explicit MpmcRing(size_type capacity);
+        MpmcRing(const MpmcRing &) = delete;
+        MpmcRing &operator=(const MpmcRing &) = delete;
+        ~MpmcRing();
+
+        bool try_push(const T &value) { return try_emplace(value); }
+        bool try_push(T &&value) { return try_emplace(std::move(value)); }
+        template <typename... Args>
+        bool try_emplace(Args &&...args);
+        // элементы переносятся из first: пакет, занятый одним CAS,
+        // должен заполниться без исключений
+        template <typename It>
+        size_type push_batch(It first, size_type n);
+
+        bool try_pop(T &out);
+        template <typename Out>
+        size_type pop_batch(Out out, size_type n);
+
+        size_type size() const;
+        bool empty() const { return size() == 0; }
+        size_type capacity() const { return mask_ + 1; }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_type> seq;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+        };
+
+        // занять до n позиций, начиная с pos; diff - какое значение
+        // seq - pos означает готовность ячейки (0 для записи, 1 для чтения)
+        size_type claim_(std::atomic<size_type> &index, size_type n, size_type diff,
+                         size_type &pos);
+
+        Cell *cells_;
+        size_type mask_;
+
+        alignas(kCacheLine) std::atomic<size_type> tail_{0};
+        alignas(kCacheLine) std::atomic<size_type> head_{0};
+    };
+
+    template <typename T>
+    MpmcRing<T>::MpmcRing(size_type capacity)
+        : cells_(nullptr), mask_(ring_detail::round_capacity(capacity) - 1)
+    {
+        cells_ = std::allocator<Cell>().allocate(mask_ + 1);
+        for (size_type i = 0; i <= mask_; ++i)
+        {
+            ::new (static_cast<void *>(cells_ + i)) Cell;
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T>
+    MpmcRing<T>::~MpmcRing()
+    {
+        size_type tail = tail_.load(std::memory_order_relaxed);
+        for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+        {
+            std::destroy_at(cells_[i & mask_].value());
+        }
+        std::allocator<Cell>().deallocate(cells_, mask_ + 1);
+    }
+
+    template <typename T>
+    typename MpmcRing<T>::size_type
+    MpmcRing<T>::claim_(std::atomic<size_type> &index, size_type n, size_type diff,
+                           size_type &pos)
+    {
+        pos = index.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            size_type ready = 0;
+            while (ready < n)
+            {
+                size_type seq = cells_[(pos + ready) & mask_].seq.load(std::memory_order_acquire);
+                if (seq != pos + ready + diff)
+                {
+                    break;
+                }
+                ++ready;
+            }
+            if (ready == 0)
+            {
+                // ячейка ещё занята предыдущим кругом или индекс устарел
+                size_type seq = cells_[pos & mask_].seq.load(std::memory_order_acquire);
+                if (static_cast<ptrdiff_t>(seq - (pos + diff)) < 0)
+                {
+                    return 0;
+                }
+                pos = index.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (index.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+            {
+                return ready;
+            }
+        }
+    }
+
+    template <typename T>
+    template <typename... Args>
+    bool MpmcRing<T>::try_emplace(Args &&...args)
+    {
+        size_type pos;
+        if (!claim_(tail_, 1, 0, pos))
+        {
+            return false;
+        }
+        Cell &cell = cells_[pos & mask_];
+        ::new (static_cast<void *>(cell.storage)) T(std::forward<Args>(args)...);
+        cell.seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T>
+    template <typename It>
+    typename MpmcRing<T>::size_type MpmcRing<T>::push_batch(It first, size_type n)
+    {
+        static_assert(std::is_nothrow_constructible_v<T, decltype(std::move(*first))>,
+                      "push_batch requires nothrow construction from *first");
+        size_type pos;
+        n = n ? claim_(tail_, n, 0, pos) : 0;
+        for (size_type i = 0; i < n; ++i, ++first)
+        {
+            Cell &cell = cells_[(pos + i) & mask_];
+            ::new (static_cast<void *>(cell.storage)) T(std::move(*first));
+            cell.seq.store(pos + i + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    template <typename T>
+    bool MpmcRing<T>::try_pop(T &out)
+    {
+        size_type pos;
+        if (!claim_(head_, 1, 1, pos))
+        {
+            return false;
+        }
+        Cell &cell = cells_[pos & mask_];
+        out = std::move(*cell.value());
+        std::destroy_at(cell.value());
+        cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T>
+    template <typename Out>
+    typename MpmcRing<T>::size_type MpmcRing<T>::pop_batch(Out out, size_type n)
+    {
+        size_type pos;
+        n = n ? claim_(head_, n, 1, pos) : 0;
+        for (size_type i = 0; i < n; ++i, ++out)
+        {
+            Cell &cell = cells_[(pos + i) & mask_];
+            *out = std::move(*cell.value());
+            std::destroy_at(cell.value());
+            cell.seq.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    template <typename T>
+    typename MpmcRing<T>::size_type MpmcRing<T>::size() const
+    {
+        size_type head = head_.load(std::memory_order_acquire);
+        size_type tail = tail_.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+}
+
+#endif // S21_RING_H
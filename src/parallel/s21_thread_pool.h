@@ -0,0 +1,245 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21
+{
+    // Пул потоков с кражей работы. У каждого потока своя очередь:
+    // владелец берёт задачи с конца (LIFO, горячий кэш), простаивающие
+    // потоки крадут с начала чужих очередей. Поток, ожидающий TaskGroup,
+    // сам выполняет задачи, поэтому вложенный параллелизм не блокируется.
+    class ThreadPool
+    {
+    public:
+        using task_type = std::function<void()>;
+
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+        {
+            threads = std::max<size_t>(threads, 1);
+            for (size_t i = 0; i < threads; ++i)
+            {
+                queues_.push_back(std::make_unique<Queue>());
+            }
+            for (size_t i = 0; i < threads; ++i)
+            {
+                workers_.emplace_back([this, i]
+                                      { work_(i); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (std::thread &worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        size_t size() const noexcept { return workers_.size(); }
+
+        // пул по умолчанию на все аппаратные потоки
+        static ThreadPool &global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        void submit(task_type task)
+        {
+            Queue &queue = *queues_[home_()];
+            // счётчик растёт до публикации задачи: иначе рабочий может
+            // забрать её и уменьшить pending_ раньше, чем он вырос
+            pending_.fetch_add(1, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex_);
+            }
+            wake_.notify_one();
+        }
+
+        // выполнить одну задачу из своей или чужой очереди
+        bool run_one()
+        {
+            task_type task;
+            if (!take_(task))
+            {
+                return false;
+            }
+            task();
+            return true;
+        }
+
+    private:
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<task_type> tasks;
+        };
+
+        struct Current
+        {
+            const ThreadPool *pool = nullptr;
+            size_t index = 0;
+        };
+
+        static Current &current_()
+        {
+            thread_local Current current;
+            return current;
+        }
+
+        // очередь, в которую кладёт задачи текущий поток
+        size_t home_()
+        {
+            Current &current = current_();
+            if (current.pool == this)
+            {
+                return current.index;
+            }
+            return next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        }
+
+        bool take_(task_type &task)
+        {
+            if (pending_.load(std::memory_order_acquire) == 0)
+            {
+                return false;
+            }
+            Current &current = current_();
+            size_t own = current.pool == this ? current.index : 0;
+            for (size_t k = 0; k < queues_.size(); ++k)
+            {
+                Queue &queue = *queues_[(own + k) % queues_.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                {
+                    continue;
+                }
+                if (k == 0 && current.pool == this)
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        void work_(size_t index)
+        {
+            current_() = Current{this, index};
+            while (true)
+            {
+                if (run_one())
+                {
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+                wake_.wait(lock, [this]
+                           { return stop_ || pending_.load(std::memory_order_acquire) > 0; });
+                if (stop_ && pending_.load(std::memory_order_acquire) == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> workers_;
+        std::atomic<size_t> pending_{0};
+        std::atomic<size_t> next_{0};
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        bool stop_ = false;
+    };
+
+    // Группа задач fork-join: run() отправляет задачу в пул, wait()
+    // помогает пулу, пока все задачи группы не завершатся, и
+    // пробрасывает первое пойманное исключение.
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup(ThreadPool &pool) : pool_(pool) {}
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+        ~TaskGroup() { drain_(); }
+
+        template <typename F>
+        void run(F &&f)
+        {
+            left_.fetch_add(1, std::memory_order_relaxed);
+            pool_.submit([this, f = std::forward<F>(f)]() mutable
+                         {
+                try
+                {
+                    f();
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex_);
+                    if (!error_)
+                    {
+                        error_ = std::current_exception();
+                    }
+                }
+                left_.fetch_sub(1, std::memory_order_acq_rel); });
+        }
+
+        void wait()
+        {
+            drain_();
+            if (error_)
+            {
+                std::exception_ptr error = error_;
+                error_ = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        void drain_()
+        {
+            while (left_.load(std::memory_order_acquire) != 0)
+            {
+                if (!pool_.run_one())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        ThreadPool &pool_;
+        std::atomic<size_t> left_{0};
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+    };
+}
+
+#endif // S21_THREAD_POOL_H
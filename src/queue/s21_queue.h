@@ -0,0 +1,77 @@
+#ifndef S21_QUEUE_H
+#define S21_QUEUE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_ring_buffer.h"
+
+namespace s21
+{
+    // Очередь FIFO поверх контейнера с push_back/pop_front/front/back;
+    // по умолчанию RingBuffer, поэтому pop - O(1) без сдвига элементов.
+    template <typename T, typename Container = RingBuffer<T>>
+    class Queue
+    {
+    public:
+        using container_type = Container;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+
+        Queue() = default;
+        Queue(std::initializer_list<value_type> const &items) : c_(items) {}
+        explicit Queue(const Container &c) : c_(c) {}
+
+        reference front()
+        {
+            checked_();
+            return c_.front();
+        }
+        const_reference front() const
+        {
+            checked_();
+            return c_.front();
+        }
+        reference back()
+        {
+            checked_();
+            return c_.back();
+        }
+        const_reference back() const
+        {
+            checked_();
+            return c_.back();
+        }
+
+        bool empty() const { return c_.empty(); }
+        size_type size() const { return c_.size(); }
+
+        void push(const_reference value) { c_.push_back(value); }
+        void push(value_type &&value) { c_.push_back(std::move(value)); }
+        template <typename... Args>
+        reference emplace(Args &&...args) { return c_.emplace_back(std::forward<Args>(args)...); }
+        void pop()
+        {
+            checked_();
+            c_.pop_front();
+        }
+        void swap(Queue &other) noexcept { c_.swap(other.c_); }
+
+    private:
+        void checked_() const
+        {
+            if (c_.empty())
+            {
+                throw std::out_of_range("Queue is empty");
+            }
+        }
+
+        Container c_;
+    };
+}
+
+#endif // S21_QUEUE_H
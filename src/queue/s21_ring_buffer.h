@@ -0,0 +1,322 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_config.h"
+
+namespace s21
+{
+    // Растущий кольцевой буфер в одном непрерывном блоке памяти.
+    // Ёмкость - степень двойки, элемент i лежит в ячейке
+    // (head_ + i) & (capacity - 1). Вставка и удаление с обоих концов
+    // O(1); при росте элементы переносятся в новый блок по порядку.
+    template <typename T>
+    class RingBuffer
+    {
+    public:
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+
+        RingBuffer() = default;
+        RingBuffer(std::initializer_list<value_type> const &items);
+        RingBuffer(const RingBuffer &other);
+        RingBuffer(RingBuffer &&other) noexcept;
+        RingBuffer &operator=(const RingBuffer &other);
+        RingBuffer &operator=(RingBuffer &&other) noexcept;
+        ~RingBuffer();
+
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        reference front();
+        const_reference front() const;
+        reference back();
+        const_reference back() const;
+
+        bool empty() const { return size_ == 0; }
+        size_type size() const { return size_; }
+        size_type capacity() const { return capacity_; }
+        size_type max_size() const;
+        void reserve(size_type new_capacity);
+        void clear();
+
+        void push_back(const_reference value) { emplace_back(value); }
+        void push_back(value_type &&value) { emplace_back(std::move(value)); }
+        void push_front(const_reference value) { emplace_front(value); }
+        void push_front(value_type &&value) { emplace_front(std::move(value)); }
+        template <typename... Args>
+        reference emplace_back(Args &&...args);
+        template <typename... Args>
+        reference emplace_front(Args &&...args);
+        void pop_back();
+        void pop_front();
+        void swap(RingBuffer &other) noexcept;
+
+    private:
+        T *slot_(size_type pos) const { return arr_ + ((head_ + pos) & (capacity_ - 1)); }
+        void grow_();
+        void reallocate_(size_type new_capacity);
+        void require_not_empty_() const;
+
+        T *arr_ = nullptr;
+        size_type capacity_ = 0;
+        size_type head_ = 0;
+        size_type size_ = 0;
+    };
+
+    template <typename T>
+    RingBuffer<T>::RingBuffer(std::initializer_list<value_type> const &items)
+    {
+        reserve(items.size());
+        for (const_reference item : items)
+        {
+            push_back(item);
+        }
+    }
+
+    template <typename T>
+    RingBuffer<T>::RingBuffer(const RingBuffer &other)
+    {
+        reserve(other.size_);
+        for (size_type i = 0; i < other.size_; ++i)
+        {
+            push_back(other[i]);
+        }
+    }
+
+    template <typename T>
+    RingBuffer<T>::RingBuffer(RingBuffer &&other) noexcept
+    {
+        swap(other);
+    }
+
+    template <typename T>
+    RingBuffer<T> &RingBuffer<T>::operator=(const RingBuffer &other)
+    {
+        if (this != &other)
+        {
+            RingBuffer tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    RingBuffer<T> &RingBuffer<T>::operator=(RingBuffer &&other) noexcept
+    {
+        if (this != &other)
+        {
+            RingBuffer tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    RingBuffer<T>::~RingBuffer()
+    {
+        clear();
+        std::allocator<T>().deallocate(arr_, capacity_);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::reference RingBuffer<T>::operator[](size_type pos)
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return *slot_(pos);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::const_reference RingBuffer<T>::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return *slot_(pos);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::reference RingBuffer<T>::front()
+    {
+        require_not_empty_();
+        return *slot_(0);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::const_reference RingBuffer<T>::front() const
+    {
+        require_not_empty_();
+        return *slot_(0);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::reference RingBuffer<T>::back()
+    {
+        require_not_empty_();
+        return *slot_(size_ - 1);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::const_reference RingBuffer<T>::back() const
+    {
+        require_not_empty_();
+        return *slot_(size_ - 1);
+    }
+
+    template <typename T>
+    typename RingBuffer<T>::size_type RingBuffer<T>::max_size() const
+    {
+        return (std::numeric_limits<size_type>::max() / 2 + 1) / sizeof(T);
+    }
+
+    // ёмкость округляется вверх до степени двойки
+    template <typename T>
+    void RingBuffer<T>::reserve(size_type new_capacity)
+    {
+        if (new_capacity <= capacity_)
+        {
+            return;
+        }
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("Can't allocate memory of this size");
+        }
+        size_type rounded = 1;
+        while (rounded < new_capacity)
+        {
+            rounded *= 2;
+        }
+        reallocate_(rounded);
+    }
+
+    template <typename T>
+    void RingBuffer<T>::clear()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (size_type i = 0; i < size_; ++i)
+            {
+                std::destroy_at(slot_(i));
+            }
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    typename RingBuffer<T>::reference RingBuffer<T>::emplace_back(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            // аргументы могут ссылаться на элементы, которые переедут
+            T tmp(std::forward<Args>(args)...);
+            grow_();
+            ::new (static_cast<void *>(slot_(size_))) T(std::move(tmp));
+        }
+        else
+        {
+            ::new (static_cast<void *>(slot_(size_))) T(std::forward<Args>(args)...);
+        }
+        return *slot_(size_++);
+    }
+
+    template <typename T>
+    template <typename... Args>
+    typename RingBuffer<T>::reference RingBuffer<T>::emplace_front(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            T tmp(std::forward<Args>(args)...);
+            grow_();
+            ::new (static_cast<void *>(slot_(capacity_ - 1))) T(std::move(tmp));
+        }
+        else
+        {
+            ::new (static_cast<void *>(slot_(capacity_ - 1))) T(std::forward<Args>(args)...);
+        }
+        head_ = (head_ + capacity_ - 1) & (capacity_ - 1);
+        ++size_;
+        return *slot_(0);
+    }
+
+    template <typename T>
+    void RingBuffer<T>::pop_back()
+    {
+        require_not_empty_();
+        --size_;
+        std::destroy_at(slot_(size_));
+    }
+
+    template <typename T>
+    void RingBuffer<T>::pop_front()
+    {
+        require_not_empty_();
+        std::destroy_at(slot_(0));
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+
+    template <typename T>
+    void RingBuffer<T>::swap(RingBuffer &other) noexcept
+    {
+        std::swap(arr_, other.arr_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    template <typename T>
+    void RingBuffer<T>::grow_()
+    {
+        if (capacity_ == max_size())
+        {
+            throw std::length_error("Can't allocate memory of this size");
+        }
+        reallocate_(capacity_ ? capacity_ * 2 : 8);
+    }
+
+    // элементы переносятся в начало нового блока по порядку
+    template <typename T>
+    void RingBuffer<T>::reallocate_(size_type new_capacity)
+    {
+        T *fresh = std::allocator<T>().allocate(new_capacity);
+        size_type moved = 0;
+        try
+        {
+            for (; moved < size_; ++moved)
+            {
+                ::new (static_cast<void *>(fresh + moved)) T(std::move_if_noexcept(*slot_(moved)));
+            }
+        }
+        catch (...)
+        {
+            std::destroy(fresh, fresh + moved);
+            std::allocator<T>().deallocate(fresh, new_capacity);
+            throw;
+        }
+        size_type count = size_;
+        clear();
+        std::allocator<T>().deallocate(arr_, capacity_);
+        arr_ = fresh;
+        capacity_ = new_capacity;
+        size_ = count;
+    }
+
+    template <typename T>
+    void RingBuffer<T>::require_not_empty_() const
+    {
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Container is empty");
+        }
+    }
+}
+
+#endif // S21_RING_BUFFER_H
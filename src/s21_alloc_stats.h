@@ -0,0 +1,229 @@
+#ifndef S21_ALLOC_STATS_H
+#define S21_ALLOC_STATS_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "s21_config.h"
+
+namespace s21
+{
+    // Учёт выделений памяти контейнерами s21 (включается
+    // S21_ALLOC_STATS=1, см. s21_config.h). Считаются выделения,
+    // освобождения, перевыделения буфера Vector и живые/пиковые байты -
+    // для каждого экземпляра и суммарно по процессу. Каждое событие
+    // можно отдать в свой обработчик через set_sink.
+    //
+    // При S21_ALLOC_STATS=0 счётчик экземпляра - пустая база без
+    // полей, вызовы пустые: размер и код контейнеров не меняются,
+    // а все счётчики читаются как нули.
+    namespace alloc_stats
+    {
+        struct Counters
+        {
+            size_t allocations = 0;
+            size_t frees = 0;
+            // перенос буфера Vector: reserve, рост, shrink_to_fit, mremap
+            size_t reallocations = 0;
+            size_t bytes_live = 0;
+            size_t bytes_peak = 0;
+        };
+
+        enum class Source
+        {
+            kVector,
+            kTree
+        };
+
+        enum class Kind
+        {
+            kAllocate,
+            kFree,
+            kReallocate
+        };
+
+        struct Event
+        {
+            Source source;
+            Kind kind;
+            // для kReallocate - новый размер буфера
+            size_t bytes;
+            // экземпляр контейнера, к которому относится событие
+            const void *owner;
+        };
+
+        // обработчик вызывается в потоке, выделившем память;
+        // nullptr отключает выгрузку
+        using Sink = void (*)(const Event &event);
+
+        namespace detail
+        {
+            struct Global
+            {
+                std::atomic<size_t> allocations{0};
+                std::atomic<size_t> frees{0};
+                std::atomic<size_t> reallocations{0};
+                std::atomic<size_t> bytes_live{0};
+                std::atomic<size_t> bytes_peak{0};
+                std::atomic<Sink> sink{nullptr};
+            };
+
+            inline Global &global()
+            {
+                static Global state;
+                return state;
+            }
+
+            inline void raise_peak(std::atomic<size_t> &peak, size_t live)
+            {
+                size_t seen = peak.load(std::memory_order_relaxed);
+                while (seen < live &&
+                       !peak.compare_exchange_weak(seen, live, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            inline void emit(Source source, Kind kind, size_t bytes, const void *owner)
+            {
+                Sink sink = global().sink.load(std::memory_order_acquire);
+                if (sink)
+                {
+                    sink(Event{source, kind, bytes, owner});
+                }
+            }
+        }
+
+        inline Counters global()
+        {
+            Counters result;
+#if S21_ALLOC_STATS
+            detail::Global &g = detail::global();
+            result.allocations = g.allocations.load(std::memory_order_relaxed);
+            result.frees = g.frees.load(std::memory_order_relaxed);
+            result.reallocations = g.reallocations.load(std::memory_order_relaxed);
+            result.bytes_live = g.bytes_live.load(std::memory_order_relaxed);
+            result.bytes_peak = g.bytes_peak.load(std::memory_order_relaxed);
+#endif
+            return result;
+        }
+
+        // обнуляет счётчики событий; пик опускается до живых байт
+        inline void reset_global()
+        {
+            detail::Global &g = detail::global();
+            g.allocations.store(0, std::memory_order_relaxed);
+            g.frees.store(0, std::memory_order_relaxed);
+            g.reallocations.store(0, std::memory_order_relaxed);
+            g.bytes_peak.store(g.bytes_live.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+        }
+
+        inline void set_sink(Sink sink)
+        {
+            detail::global().sink.store(sink, std::memory_order_release);
+        }
+
+        // Счётчики одного экземпляра; контейнер наследует Tracker
+        // закрыто. Экземпляр не потокобезопасен, как и сам контейнер.
+        template <bool Enabled = S21_ALLOC_STATS != 0>
+        class Tracker
+        {
+        public:
+            Counters alloc_stats() const { return counters_; }
+
+        protected:
+            Tracker() = default;
+            // копия начинает учёт с нуля
+            Tracker(const Tracker &) {}
+            Tracker &operator=(const Tracker &) { return *this; }
+
+            void on_allocate_(Source source, size_t bytes)
+            {
+                ++counters_.allocations;
+                counters_.bytes_live += bytes;
+                if (counters_.bytes_live > counters_.bytes_peak)
+                {
+                    counters_.bytes_peak = counters_.bytes_live;
+                }
+                detail::Global &g = detail::global();
+                g.allocations.fetch_add(1, std::memory_order_relaxed);
+                size_t live = g.bytes_live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+                detail::raise_peak(g.bytes_peak, live);
+                detail::emit(source, Kind::kAllocate, bytes, this);
+            }
+
+            void on_free_(Source source, size_t bytes)
+            {
+                ++counters_.frees;
+                counters_.bytes_live -= bytes;
+                detail::Global &g = detail::global();
+                g.frees.fetch_add(1, std::memory_order_relaxed);
+                g.bytes_live.fetch_sub(bytes, std::memory_order_relaxed);
+                detail::emit(source, Kind::kFree, bytes, this);
+            }
+
+            // сами выделение и освобождение учитываются отдельно
+            void on_reallocate_(Source source, size_t new_bytes)
+            {
+                ++counters_.reallocations;
+                detail::global().reallocations.fetch_add(1, std::memory_order_relaxed);
+                detail::emit(source, Kind::kReallocate, new_bytes, this);
+            }
+
+            // буфер переехал в ядре (mremap) без выделения
+            void on_resize_(size_t old_bytes, size_t new_bytes)
+            {
+                counters_.bytes_live += new_bytes - old_bytes;
+                if (counters_.bytes_live > counters_.bytes_peak)
+                {
+                    counters_.bytes_peak = counters_.bytes_live;
+                }
+                detail::Global &g = detail::global();
+                size_t live = g.bytes_live.fetch_add(new_bytes - old_bytes,
+                                                     std::memory_order_relaxed) +
+                              (new_bytes - old_bytes);
+                detail::raise_peak(g.bytes_peak, live);
+            }
+
+            // при перемещении контейнера учёт переезжает вместе с памятью
+            void take_alloc_stats_(Tracker &other)
+            {
+                counters_.allocations += other.counters_.allocations;
+                counters_.frees += other.counters_.frees;
+                counters_.reallocations += other.counters_.reallocations;
+                counters_.bytes_live += other.counters_.bytes_live;
+                if (counters_.bytes_live > counters_.bytes_peak)
+                {
+                    counters_.bytes_peak = counters_.bytes_live;
+                }
+                other.counters_ = Counters{};
+            }
+            void swap_alloc_stats_(Tracker &other)
+            {
+                Counters tmp = counters_;
+                counters_ = other.counters_;
+                other.counters_ = tmp;
+            }
+
+        private:
+            Counters counters_;
+        };
+
+        template <>
+        class Tracker<false>
+        {
+        public:
+            Counters alloc_stats() const { return Counters{}; }
+
+        protected:
+            void on_allocate_(Source, size_t) {}
+            void on_free_(Source, size_t) {}
+            void on_reallocate_(Source, size_t) {}
+            void on_resize_(size_t, size_t) {}
+            void take_alloc_stats_(Tracker &) {}
+            void swap_alloc_stats_(Tracker &) {}
+        };
+    }
+}
+
+#endif // S21_ALLOC_STATS_H
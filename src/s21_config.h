@@ -0,0 +1,74 @@
+#ifndef S21_CONFIG_H
+#define S21_CONFIG_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+// Проверка индекса в operator[] контейнеров s21:
+//   0 - без проверки (по умолчанию при NDEBUG),
+//   1 - std::out_of_range (по умолчанию в отладочной сборке),
+//   2 - аварийное завершение (hardened-режим).
+// at() проверяет индекс всегда и бросает исключение.
+#define S21_BOUNDS_UNCHECKED 0
+#define S21_BOUNDS_THROW 1
+#define S21_BOUNDS_ABORT 2
+
+#ifndef S21_BOUNDS_CHECK
+#ifdef NDEBUG
+#define S21_BOUNDS_CHECK S21_BOUNDS_UNCHECKED
+#else
+#define S21_BOUNDS_CHECK S21_BOUNDS_THROW
+#endif
+#endif
+
+// Учёт выделений памяти (s21_alloc_stats.h): 0 - выключен, код и
+// размер контейнеров не меняются; 1 - счётчики и обработчик событий.
+// Значение должно совпадать во всех единицах трансляции.
+#ifndef S21_ALLOC_STATS
+#define S21_ALLOC_STATS 0
+#endif
+
+#if defined(__GNUC__)
+#define S21_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define S21_UNLIKELY(x) (x)
+#endif
+
+namespace s21
+{
+    // Политики проверки индекса; Mode - одно из значений S21_BOUNDS_*
+    template <int Mode>
+    struct BoundsCheck
+    {
+        static void check(size_t pos, size_t size)
+        {
+            if constexpr (Mode == S21_BOUNDS_THROW)
+            {
+                if (S21_UNLIKELY(pos >= size))
+                {
+                    throw std::out_of_range("Index out of range");
+                }
+            }
+            else if constexpr (Mode == S21_BOUNDS_ABORT)
+            {
+                if (S21_UNLIKELY(pos >= size))
+                {
+                    std::fprintf(stderr, "s21: index %zu out of range [0, %zu)\n",
+                                 pos, size);
+                    std::abort();
+                }
+            }
+            else
+            {
+                (void)pos;
+                (void)size;
+            }
+        }
+    };
+
+    using DefaultBoundsCheck = BoundsCheck<S21_BOUNDS_CHECK>;
+}
+
+#endif // S21_CONFIG_H
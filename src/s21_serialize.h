@@ -0,0 +1,376 @@
+#ifndef S21_SERIALIZE_H
+#define S21_SERIALIZE_H
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace s21
+{
+    // Двоичный формат контейнеров s21.
+    //
+    // Заголовок (24 байта, порядок байт машины):
+    //   magic "S21C" | version u16 | kind u8 | flags u8 |
+    //   elem_size u32 | reserved u32 | count u64
+    // Далее count элементов. Если установлен kPod, элементы записаны
+    // сырыми байтами по elem_size, иначе каждый элемент пишет
+    // Serializer<T>: строки как u64 длина + байты, пары поэлементно.
+    // Упорядоченные контейнеры пишутся в порядке обхода, т.е. по
+    // возрастанию ключа.
+    namespace serialize
+    {
+        inline constexpr char kMagic[4] = {'S', '2', '1', 'C'};
+        inline constexpr uint16_t kVersion = 1;
+
+        enum Kind : uint8_t
+        {
+            kVector = 1,
+            kMap = 2,
+            kSet = 3
+        };
+
+        enum Flags : uint8_t
+        {
+            kPod = 1,
+            kBigEndian = 2
+        };
+
+        struct Header
+        {
+            char magic[4];
+            uint16_t version;
+            uint8_t kind;
+            uint8_t flags;
+            uint32_t elem_size;
+            uint32_t reserved;
+            uint64_t count;
+        };
+        static_assert(sizeof(Header) == 24, "unexpected header layout");
+
+        inline uint8_t native_flags()
+        {
+            const uint16_t probe = 1;
+            return *reinterpret_cast<const uint8_t *>(&probe) ? 0 : kBigEndian;
+        }
+
+        inline void write_bytes(std::ostream &out, const void *p, size_t n)
+        {
+            if (!out.write(static_cast<const char *>(p), static_cast<std::streamsize>(n)))
+            {
+                throw std::runtime_error("s21::serialize: write failed");
+            }
+        }
+
+        inline void read_bytes(std::istream &in, void *p, size_t n)
+        {
+            if (!in.read(static_cast<char *>(p), static_cast<std::streamsize>(n)))
+            {
+                throw std::runtime_error("s21::serialize: unexpected end of input");
+            }
+        }
+
+        // Сколько элементов по elem_size байт читать следующим блоком,
+        // когда всего ждём ещё remaining, а done уже прочитано. Блок не
+        // больше 1 МиБ или уже прочитанного, так что испорченный
+        // заголовок не заставит выделить память сверх вдвое большей,
+        // чем реально пришло.
+        inline size_t read_chunk(uint64_t remaining, size_t done, size_t elem_size)
+        {
+            size_t step = std::max<size_t>((size_t(1) << 20) / elem_size, 1);
+            return static_cast<size_t>(std::min<uint64_t>(remaining, std::max(step, done)));
+        }
+
+        // Кодек одного элемента. Специализируется для собственных типов.
+        template <typename T, typename = void>
+        struct Serializer
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "no s21::serialize::Serializer for this type");
+
+            static void write(std::ostream &out, const T &value)
+            {
+                write_bytes(out, &value, sizeof(T));
+            }
+
+            static void read(std::istream &in, T &value)
+            {
+                read_bytes(in, &value, sizeof(T));
+            }
+        };
+
+        template <typename C, typename Tr, typename A>
+        struct Serializer<std::basic_string<C, Tr, A>>
+        {
+            static void write(std::ostream &out, const std::basic_string<C, Tr, A> &s)
+            {
+                uint64_t n = s.size();
+                write_bytes(out, &n, sizeof(n));
+                write_bytes(out, s.data(), n * sizeof(C));
+            }
+
+            static void read(std::istream &in, std::basic_string<C, Tr, A> &s)
+            {
+                uint64_t n = 0;
+                read_bytes(in, &n, sizeof(n));
+                // длина недоверенная: растём по мере прихода байт
+                s.clear();
+                while (s.size() < n)
+                {
+                    size_t done = s.size();
+                    size_t part = read_chunk(n - done, done, sizeof(C));
+                    s.resize(done + part);
+                    read_bytes(in, s.data() + done, part * sizeof(C));
+                }
+            }
+        };
+
+        template <typename A, typename B>
+        struct Serializer<std::pair<A, B>>
+        {
+            static void write(std::ostream &out, const std::pair<A, B> &p)
+            {
+                Serializer<std::remove_const_t<A>>::write(out, p.first);
+                Serializer<B>::write(out, p.second);
+            }
+
+            static void read(std::istream &in, std::pair<A, B> &p)
+            {
+                Serializer<std::remove_const_t<A>>::read(
+                    in, const_cast<std::remove_const_t<A> &>(p.first));
+                Serializer<B>::read(in, p.second);
+            }
+        };
+
+        template <typename T>
+        void write_value(std::ostream &out, const T &value)
+        {
+            Serializer<T>::write(out, value);
+        }
+
+        template <typename T>
+        void read_value(std::istream &in, T &value)
+        {
+            Serializer<T>::read(in, value);
+        }
+
+        inline void write_header(std::ostream &out, Kind kind, bool pod,
+                                 uint32_t elem_size, uint64_t count)
+        {
+            Header h{};
+            std::memcpy(h.magic, kMagic, sizeof(kMagic));
+            h.version = kVersion;
+            h.kind = kind;
+            h.flags = static_cast<uint8_t>((pod ? kPod : 0) | native_flags());
+            h.elem_size = elem_size;
+            h.count = count;
+            write_bytes(out, &h, sizeof(h));
+        }
+
+        // читает и проверяет заголовок, возвращает число элементов
+        inline uint64_t read_header(std::istream &in, Kind kind, bool pod,
+                                    uint32_t elem_size)
+        {
+            Header h{};
+            read_bytes(in, &h, sizeof(h));
+            if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0)
+            {
+                throw std::runtime_error("s21::serialize: bad magic");
+            }
+            if (h.version != kVersion)
+            {
+                throw std::runtime_error("s21::serialize: unsupported version");
+            }
+            if (h.kind != kind || (h.flags & kBigEndian) != native_flags())
+            {
+                throw std::runtime_error("s21::serialize: container kind mismatch");
+            }
+            if (bool(h.flags & kPod) != pod || (pod && h.elem_size != elem_size))
+            {
+                throw std::runtime_error("s21::serialize: element type mismatch");
+            }
+            return h.count;
+        }
+
+        // Потоковые буферы поверх файлового дескриптора, чтобы
+        // save(int)/load(int) шли через тот же код, что и потоки.
+        class FdOutBuf : public std::streambuf
+        {
+        public:
+            explicit FdOutBuf(int fd) : fd_(fd) { setp(buf_, buf_ + sizeof(buf_)); }
+            ~FdOutBuf() override { sync(); }
+
+        protected:
+            int_type overflow(int_type ch) override
+            {
+                if (sync() != 0)
+                {
+                    return traits_type::eof();
+                }
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    *pptr() = traits_type::to_char_type(ch);
+                    pbump(1);
+                }
+                return traits_type::not_eof(ch);
+            }
+
+            std::streamsize xsputn(const char *s, std::streamsize n) override
+            {
+                if (n < static_cast<std::streamsize>(sizeof(buf_)))
+                {
+                    return std::streambuf::xsputn(s, n);
+                }
+                // крупные блоки пишутся мимо буфера
+                if (sync() != 0 || !write_all_(s, static_cast<size_t>(n)))
+                {
+                    return 0;
+                }
+                return n;
+            }
+
+            int sync() override
+            {
+                size_t n = static_cast<size_t>(pptr() - pbase());
+                if (n && !write_all_(pbase(), n))
+                {
+                    return -1;
+                }
+                setp(buf_, buf_ + sizeof(buf_));
+                return 0;
+            }
+
+        private:
+            bool write_all_(const char *p, size_t n)
+            {
+                while (n)
+                {
+                    ssize_t w = ::write(fd_, p, n);
+                    if (w < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if (w <= 0)
+                    {
+                        return false;
+                    }
+                    p += w;
+                    n -= static_cast<size_t>(w);
+                }
+                return true;
+            }
+
+            int fd_;
+            char buf_[1 << 16];
+        };
+
+        class FdInBuf : public std::streambuf
+        {
+        public:
+            explicit FdInBuf(int fd) : fd_(fd) { setg(buf_, buf_, buf_); }
+            // непрочитанный остаток буфера возвращается в файл, чтобы
+            // следующий load(fd) начал с нужного места (если fd seekable)
+            ~FdInBuf() override
+            {
+                if (egptr() != gptr())
+                {
+                    ::lseek(fd_, -static_cast<off_t>(egptr() - gptr()), SEEK_CUR);
+                }
+            }
+
+        protected:
+            int_type underflow() override
+            {
+                ssize_t r = read_some_(buf_, sizeof(buf_));
+                if (r <= 0)
+                {
+                    return traits_type::eof();
+                }
+                setg(buf_, buf_, buf_ + r);
+                return traits_type::to_int_type(*gptr());
+            }
+
+            std::streamsize xsgetn(char *s, std::streamsize n) override
+            {
+                std::streamsize done = std::min<std::streamsize>(n, egptr() - gptr());
+                std::memcpy(s, gptr(), static_cast<size_t>(done));
+                gbump(static_cast<int>(done));
+                // остаток крупного блока читается мимо буфера
+                while (done < n)
+                {
+                    if (n - done < static_cast<std::streamsize>(sizeof(buf_)))
+                    {
+                        if (traits_type::eq_int_type(underflow(), traits_type::eof()))
+                        {
+                            break;
+                        }
+                        std::streamsize part = std::min<std::streamsize>(n - done, egptr() - gptr());
+                        std::memcpy(s + done, gptr(), static_cast<size_t>(part));
+                        gbump(static_cast<int>(part));
+                        done += part;
+                        continue;
+                    }
+                    ssize_t r = read_some_(s + done, static_cast<size_t>(n - done));
+                    if (r <= 0)
+                    {
+                        break;
+                    }
+                    done += r;
+                }
+                return done;
+            }
+
+        private:
+            ssize_t read_some_(char *p, size_t n)
+            {
+                ssize_t r;
+                do
+                {
+                    r = ::read(fd_, p, n);
+                } while (r < 0 && errno == EINTR);
+                return r;
+            }
+
+            int fd_;
+            char buf_[1 << 16];
+        };
+
+        template <typename Container>
+        void save_fd(const Container &c, int fd)
+        {
+            FdOutBuf buf(fd);
+            std::ostream out(&buf);
+            c.save(out);
+            if (!out.flush())
+            {
+                throw std::runtime_error("s21::serialize: write failed");
+            }
+        }
+
+        template <typename Container>
+        void load_fd(Container &c, int fd)
+        {
+            FdInBuf buf(fd);
+            std::istream in(&buf);
+            c.load(in);
+        }
+
+        // число элементов, под которое безопасно резервировать память
+        // до фактического чтения (count берётся из недоверенного файла)
+        inline size_t reserve_hint(uint64_t count)
+        {
+            return static_cast<size_t>(std::min<uint64_t>(count, uint64_t(1) << 20));
+        }
+    }
+}
+
+#endif // S21_SERIALIZE_H
@@ -0,0 +1,185 @@
+#ifndef S21_TRACE_H
+#define S21_TRACE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace s21
+{
+    // Политики трассировки операций Tree (параметр шаблона Tracer).
+    // Дерево спрашивает sample(op) перед операцией и, если ответ
+    // true, отдаёт в record(op, trace) сколько сравнений сделано и
+    // узлов пройдено (для выделения узла - сколько наносекунд оно
+    // заняло). NoTrace отвечает false на этапе компиляции, поэтому
+    // счётчики и замеры времени выбрасываются компилятором.
+    //
+    // Методы политики константные: поиск в const-дереве тоже
+    // трассируется, состояние трассировщика хранится в mutable полях.
+    namespace trace
+    {
+        enum class Op
+        {
+            kFind,
+            kInsert,
+            kErase,
+            kAllocate
+        };
+
+        inline constexpr size_t kOpCount = 4;
+
+        inline const char *op_name(Op op)
+        {
+            switch (op)
+            {
+            case Op::kFind:
+                return "find";
+            case Op::kInsert:
+                return "insert";
+            case Op::kErase:
+                return "erase";
+            case Op::kAllocate:
+                return "allocate";
+            }
+            return "?";
+        }
+
+        struct OpTrace
+        {
+            size_t comparisons = 0;
+            // find, insert - длина пути от корня; erase - узлы,
+            // пройденные при поиске замены и перевешивании
+            size_t visited = 0;
+            // повороты самонастраивающегося поиска (AccessMode)
+            size_t rotations = 0;
+            uint64_t nanoseconds = 0;
+        };
+
+        struct NoTrace
+        {
+            static constexpr bool sample(Op) { return false; }
+            void record(Op, const OpTrace &) const {}
+        };
+
+        // Гистограмма с корзинами по степеням двойки: корзина 0 - нули,
+        // корзина b > 0 - значения из [2^(b-1), 2^b).
+        class Histogram
+        {
+        public:
+            static constexpr size_t kBuckets = 65;
+
+            void add(uint64_t value)
+            {
+                ++buckets_[bucket_of(value)];
+                ++count_;
+                sum_ += value;
+                max_ = value > max_ ? value : max_;
+            }
+
+            static size_t bucket_of(uint64_t value)
+            {
+                return value ? 64 - __builtin_clzll(value) : 0;
+            }
+
+            uint64_t count() const { return count_; }
+            uint64_t max() const { return max_; }
+            double mean() const { return count_ ? static_cast<double>(sum_) / count_ : 0.0; }
+            uint64_t bucket(size_t b) const { return buckets_[b]; }
+
+            void dump(std::ostream &out) const
+            {
+                out << "n=" << count_ << " mean=" << mean() << " max=" << max_;
+                for (size_t b = 0; b < kBuckets; ++b)
+                {
+                    if (buckets_[b])
+                    {
+                        uint64_t lo = b ? uint64_t(1) << (b - 1) : 0;
+                        out << " [" << lo << "+]:" << buckets_[b];
+                    }
+                }
+                out << '\n';
+            }
+
+        private:
+            std::array<uint64_t, kBuckets> buckets_{};
+            uint64_t count_ = 0;
+            uint64_t sum_ = 0;
+            uint64_t max_ = 0;
+        };
+
+        struct OpHistograms
+        {
+            Histogram comparisons;
+            Histogram visited;
+            Histogram rotations;
+            Histogram nanoseconds;
+        };
+
+        // записывает каждую операцию
+        class CountingTracer
+        {
+        public:
+            static constexpr bool sample(Op) { return true; }
+
+            void record(Op op, const OpTrace &trace) const
+            {
+                OpHistograms &h = ops_[static_cast<size_t>(op)];
+                if (op == Op::kAllocate)
+                {
+                    h.nanoseconds.add(trace.nanoseconds);
+                    return;
+                }
+                h.comparisons.add(trace.comparisons);
+                h.visited.add(trace.visited);
+                h.rotations.add(trace.rotations);
+            }
+
+            const OpHistograms &histograms(Op op) const { return ops_[static_cast<size_t>(op)]; }
+            void reset() const { ops_ = {}; }
+
+            void dump(std::ostream &out) const
+            {
+                for (size_t i = 0; i < kOpCount; ++i)
+                {
+                    const OpHistograms &h = ops_[i];
+                    const char *name = op_name(static_cast<Op>(i));
+                    if (static_cast<Op>(i) == Op::kAllocate)
+                    {
+                        out << name << " ns: ";
+                        h.nanoseconds.dump(out);
+                        continue;
+                    }
+                    out << name << " comparisons: ";
+                    h.comparisons.dump(out);
+                    out << name << " visited: ";
+                    h.visited.dump(out);
+                    if (h.rotations.max())
+                    {
+                        out << name << " rotations: ";
+                        h.rotations.dump(out);
+                    }
+                }
+            }
+
+        private:
+            mutable std::array<OpHistograms, kOpCount> ops_{};
+        };
+
+        // записывает каждую Period-ю операцию каждого вида: дешевле
+        // на горячем пути, гистограммы остаются представительными
+        template <size_t Period = 64>
+        class SamplingTracer : public CountingTracer
+        {
+            static_assert(Period > 0, "sampling period must be positive");
+
+        public:
+            bool sample(Op op) const { return seen_[static_cast<size_t>(op)]++ % Period == 0; }
+
+        private:
+            mutable std::array<uint64_t, kOpCount> seen_{};
+        };
+    }
+}
+
+#endif // S21_TRACE_H
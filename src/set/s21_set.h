@@ -1,13 +1,20 @@
-#ifndef VECTOR_H
-#define VECTOR_H
+#ifndef S21_SET_H
+#define S21_SET_H
 
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "../frozen/s21_frozen_index.h"
+#include "../s21_serialize.h"
 #include "../tree.h"
 namespace s21
 {
-    template <typename K>
+    // Tracer - политика трассировки операций дерева (см. s21_trace.h),
+    // Prefix - префикс ключа в узлах (см. KeyPrefix в tree.h)
+    template <typename K, typename Tracer = trace::NoTrace, typename Prefix = KeyPrefix<K>>
     class Set
     {
     private:
@@ -17,8 +24,8 @@ namespace s21
         using reference = K &;
         using const_reference = const K &;
         using size_type = size_t;
-        using iterator = typename Tree<key_type>::iterator;
-        using const_iterator = typename Tree<key_type>::const_iterator;
+        using iterator = typename Tree<key_type, key_type, Tracer, Prefix>::iterator;
+        using const_iterator = typename Tree<key_type, key_type, Tracer, Prefix>::const_iterator;
         // iterator
         // const_iterator
 
@@ -30,7 +37,7 @@ namespace s21
             {
                 pair_init.push_back(std::make_pair(key, key));
             }
-            tree_ = Tree<key_type, key_type>(pair_init);
+            tree_ = Tree<key_type, key_type, Tracer, Prefix>(pair_init);
         }
         Set(const Set &other) : tree_(other.tree_) {}
         Set(Set &&other) noexcept : tree_(std::move(other.tree_)) {}
@@ -62,6 +69,20 @@ namespace s21
         void erase(iterator pos) { tree_.erase(pos); }
         void swap(Set &other) { tree_.swap(other.tree_); }
 
+        // счётчики выделений узлов (нули при S21_ALLOC_STATS=0)
+        alloc_stats::Counters alloc_stats() const { return tree_.alloc_stats(); }
+
+        const Tracer &tracer() const { return tree_.tracer(); }
+
+        // перестройка дерева при поиске (см. AccessMode в tree.h)
+        void set_access_mode(AccessMode mode) noexcept { tree_.set_access_mode(mode); }
+        AccessMode access_mode() const noexcept { return tree_.access_mode(); }
+
+        // форма дерева (см. TreeStats в tree.h)
+        TreeStats stats() const { return tree_.stats(); }
+        void track_height(bool enabled) { tree_.track_height(enabled); }
+        size_type height_bound() const { return tree_.height_bound(); }
+
         std::pair<iterator, bool> insert(const value_type &value)
         {
             // return tree_.insert(value);
@@ -77,9 +98,64 @@ namespace s21
             return tree_.contains(key);
         }
 
+        // неизменяемая копия для поиска (см. frozen/s21_frozen_index.h)
+        FrozenIndex<key_type> freeze() const
+        {
+            std::vector<key_type> keys;
+            keys.reserve(size());
+            for (iterator it = begin(); it != end(); ++it)
+            {
+                keys.push_back(it->first);
+            }
+            return FrozenIndex<key_type>(keys);
+        }
+
+        // двоичное сохранение/загрузка, формат описан в s21_serialize.h;
+        // отсортированные данные загружаются в дерево за O(n)
+        void save(std::ostream &out) const
+        {
+            serialize::write_header(out, serialize::kSet, kPod, sizeof(key_type),
+                                    size());
+            for (iterator it = begin(); it != end(); ++it)
+            {
+                serialize::write_value(out, it->first);
+            }
+        }
+
+        void load(std::istream &in)
+        {
+            uint64_t count = serialize::read_header(in, serialize::kSet, kPod,
+                                                    sizeof(key_type));
+            std::vector<std::pair<key_type, key_type>> items;
+            items.reserve(serialize::reserve_hint(count));
+            bool sorted = true;
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                key_type key;
+                serialize::read_value(in, key);
+                sorted = sorted && (items.empty() || items.back().first < key);
+                items.emplace_back(key, key);
+            }
+            if (sorted)
+            {
+                tree_.assign_sorted(items.begin(), items.end());
+                return;
+            }
+            tree_.clear();
+            for (const auto &item : items)
+            {
+                tree_.insert(item);
+            }
+        }
+
+        void save(int fd) const { serialize::save_fd(*this, fd); }
+        void load(int fd) { serialize::load_fd(*this, fd); }
+
     private:
-        Tree<key_type> tree_;
+        static constexpr bool kPod = std::is_trivially_copyable_v<key_type>;
+
+        Tree<key_type, key_type, Tracer, Prefix> tree_;
     };
 }
 
-#endif
+#endif // S21_SET_H
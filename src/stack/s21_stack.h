@@ -0,0 +1,61 @@
+#ifndef S21_STACK_H
+#define S21_STACK_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21
+{
+    // Стек LIFO поверх контейнера с push_back/pop_back/operator[];
+    // по умолчанию Vector - непрерывный буфер, вершина в его конце.
+    template <typename T, typename Container = Vector<T>>
+    class Stack
+    {
+    public:
+        using container_type = Container;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+
+        Stack() = default;
+        Stack(std::initializer_list<value_type> const &items) : c_(items) {}
+        explicit Stack(const Container &c) : c_(c) {}
+
+        reference top() { return c_[checked_()]; }
+        const_reference top() const { return c_[checked_()]; }
+
+        bool empty() const { return c_.empty(); }
+        size_type size() const { return c_.size(); }
+
+        void push(const_reference value) { c_.push_back(value); }
+        void push(value_type &&value) { c_.push_back(std::move(value)); }
+        template <typename... Args>
+        reference emplace(Args &&...args) { return c_.emplace_back(std::forward<Args>(args)...); }
+        void pop()
+        {
+            checked_();
+            c_.pop_back();
+        }
+        void swap(Stack &other) noexcept { c_.swap(other.c_); }
+
+    private:
+        // индекс вершины
+        size_type checked_() const
+        {
+            if (c_.empty())
+            {
+                throw std::out_of_range("Stack is empty");
+            }
+            return c_.size() - 1;
+        }
+
+        Container c_;
+    };
+}
+
+#endif // S21_STACK_H
@@ -0,0 +1,116 @@
+#define S21_ALLOC_STATS 1
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "../set/s21_set.h"
+#include "../vector/s21_vector.h"
+
+TEST(AllocStats, VectorInstance)
+{
+    s21::Vector<int> v;
+    v.reserve(16);
+    auto stats = v.alloc_stats();
+    EXPECT_EQ(stats.allocations, 1U);
+    EXPECT_EQ(stats.frees, 0U);
+    EXPECT_EQ(stats.reallocations, 1U);
+    EXPECT_EQ(stats.bytes_live, 16 * sizeof(int));
+
+    for (int i = 0; i < 17; ++i)
+    {
+        v.push_back(i);
+    }
+    stats = v.alloc_stats();
+    EXPECT_EQ(stats.allocations, 2U);
+    EXPECT_EQ(stats.frees, 1U);
+    EXPECT_EQ(stats.reallocations, 2U);
+    EXPECT_EQ(stats.bytes_live, 32 * sizeof(int));
+    EXPECT_EQ(stats.bytes_peak, 48 * sizeof(int));
+
+    // копия считает свои выделения с нуля
+    s21::Vector<int> copy(v);
+    EXPECT_EQ(copy.alloc_stats().allocations, 1U);
+    EXPECT_EQ(copy.alloc_stats().bytes_live, 17 * sizeof(int));
+
+    // перемещение уносит учёт вместе с буфером
+    s21::Vector<int> moved(std::move(v));
+    EXPECT_EQ(moved.alloc_stats().bytes_live, 32 * sizeof(int));
+    EXPECT_EQ(v.alloc_stats().allocations, 0U);
+
+    moved.clear();
+    EXPECT_EQ(moved.alloc_stats().bytes_live, 0U);
+    EXPECT_EQ(moved.alloc_stats().frees, 2U);
+}
+
+TEST(AllocStats, TreeNodes)
+{
+    s21::Map<int, int> m;
+    for (int i = 0; i < 10; ++i)
+    {
+        m.insert({(i * 7) % 10, i});
+    }
+    m.insert({3, 0});
+    auto stats = m.alloc_stats();
+    EXPECT_EQ(stats.allocations, 10U);
+    EXPECT_EQ(stats.reallocations, 0U);
+    size_t node = stats.bytes_live / 10;
+    EXPECT_GE(node, sizeof(std::pair<const int, int>) + 3 * sizeof(void *));
+
+    m.erase(m.find(3));
+    m.erase(m.find(0));
+    EXPECT_EQ(m.alloc_stats().frees, 2U);
+    EXPECT_EQ(m.alloc_stats().bytes_live, 8 * node);
+    EXPECT_EQ(m.alloc_stats().bytes_peak, 10 * node);
+    m.clear();
+    EXPECT_EQ(m.alloc_stats().bytes_live, 0U);
+
+    s21::Set<int> s;
+    s.insert(1);
+    s.insert(2);
+    EXPECT_EQ(s.alloc_stats().allocations, 2U);
+}
+
+static std::vector<s21::alloc_stats::Event> events;
+
+static void record(const s21::alloc_stats::Event &event)
+{
+    events.push_back(event);
+}
+
+TEST(AllocStats, GlobalAndSink)
+{
+    using namespace s21::alloc_stats;
+    reset_global();
+    Counters before = global();
+    events.clear();
+    set_sink(record);
+    {
+        s21::Vector<uint64_t> v;
+        v.push_back(1);
+        v.push_back(2);
+        s21::Set<int> s;
+        s.insert(5);
+        EXPECT_EQ(global().bytes_live - before.bytes_live,
+                  v.alloc_stats().bytes_live + s.alloc_stats().bytes_live);
+    }
+    set_sink(nullptr);
+
+    Counters after = global();
+    EXPECT_EQ(after.allocations, 3U);
+    EXPECT_EQ(after.frees, 3U);
+    EXPECT_EQ(after.reallocations, 2U);
+    EXPECT_EQ(after.bytes_live, before.bytes_live);
+    EXPECT_GE(after.bytes_peak, before.bytes_live + 2 * sizeof(uint64_t));
+
+    ASSERT_EQ(events.size(), 8U);
+    EXPECT_EQ(events[0].source, Source::kVector);
+    EXPECT_EQ(events[0].kind, Kind::kReallocate);
+    EXPECT_EQ(events[1].kind, Kind::kAllocate);
+    EXPECT_EQ(events[1].bytes, sizeof(uint64_t));
+    EXPECT_EQ(events[5].source, Source::kTree);
+    EXPECT_EQ(events[5].kind, Kind::kAllocate);
+}
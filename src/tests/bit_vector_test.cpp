@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../vector/s21_bit_vector.h"
+
+static std::vector<bool> random_bits(size_t n, unsigned seed, int percent)
+{
+    std::mt19937 rng(seed);
+    std::vector<bool> bits(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        bits[i] = int(rng() % 100) < percent;
+    }
+    return bits;
+}
+
+static s21::BitVector from(const std::vector<bool> &bits)
+{
+    s21::BitVector result;
+    for (bool bit : bits)
+    {
+        result.push_back(bit);
+    }
+    return result;
+}
+
+TEST(BitVector, ProxyReference)
+{
+    s21::BitVector bits(130);
+    EXPECT_EQ(bits.size(), 130U);
+    EXPECT_EQ(bits.word_count(), 3U);
+    EXPECT_TRUE(bits.none());
+    bits[0] = true;
+    bits[129] = true;
+    bits[64] = bits[0];
+    bits[65].flip();
+    EXPECT_TRUE(bits[0]);
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_TRUE(bits[65]);
+    EXPECT_FALSE(bits[1]);
+    EXPECT_EQ(bits.count(), 4U);
+    bits.reset(0).flip(1).set(2);
+    EXPECT_FALSE(bits[0]);
+    EXPECT_TRUE(bits[1]);
+    EXPECT_THROW(bits.at(130), std::out_of_range);
+    EXPECT_THROW(bits.set(130), std::out_of_range);
+
+    s21::BitVector list{true, false, true};
+    EXPECT_EQ(list.count(), 2U);
+    EXPECT_TRUE(list.back());
+    list.pop_back();
+    EXPECT_FALSE(list.back());
+}
+
+TEST(BitVector, ResizeKeepsTailClear)
+{
+    s21::BitVector bits(70, true);
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(bits.count(), 70U);
+    bits.resize(10);
+    EXPECT_EQ(bits.count(), 10U);
+    bits.resize(200);
+    EXPECT_EQ(bits.count(), 10U);
+    bits.resize(250, true);
+    EXPECT_EQ(bits.count(), 60U);
+    EXPECT_EQ(~bits, s21::BitVector(bits).flip());
+    EXPECT_EQ((~bits).count(), 190U);
+    bits.set();
+    EXPECT_TRUE(bits.all());
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+    EXPECT_EQ(bits.find_first(), s21::BitVector::npos);
+}
+
+TEST(BitVector, CountAndFindMatchReference)
+{
+    for (size_t n : {0U, 1U, 63U, 64U, 65U, 1000U, 100003U})
+    {
+        std::vector<bool> ref = random_bits(n, unsigned(n), 3);
+        s21::BitVector bits = from(ref);
+        size_t expected = 0;
+        for (bool b : ref)
+        {
+            expected += b;
+        }
+        EXPECT_EQ(bits.count(), expected);
+
+        std::vector<size_t> found;
+        for (size_t i = bits.find_first(); i != s21::BitVector::npos; i = bits.find_next(i))
+        {
+            found.push_back(i);
+        }
+        ASSERT_EQ(found.size(), expected);
+        for (size_t i : found)
+        {
+            ASSERT_TRUE(ref[i]);
+        }
+        EXPECT_EQ(bits.find_next(s21::BitVector::npos), s21::BitVector::npos);
+        EXPECT_EQ(bits.find_next(n), s21::BitVector::npos);
+    }
+}
+
+TEST(BitVector, BulkOpsOnAllLevels)
+{
+    const size_t n = 10007;
+    std::vector<bool> ra = random_bits(n, 1, 50);
+    std::vector<bool> rb = random_bits(n, 2, 50);
+    s21::simd::Level original = s21::simd::active();
+    for (auto level : {s21::simd::Level::kScalar, s21::simd::Level::kSse4,
+                       s21::simd::Level::kAvx2})
+    {
+        s21::simd::force(level);
+        s21::BitVector a = from(ra);
+        s21::BitVector b = from(rb);
+        s21::BitVector and_bits = a & b;
+        s21::BitVector or_bits = a | b;
+        s21::BitVector xor_bits = a ^ b;
+        size_t and_count = 0, or_count = 0, xor_count = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(and_bits[i], ra[i] && rb[i]);
+            ASSERT_EQ(or_bits[i], ra[i] || rb[i]);
+            ASSERT_EQ(xor_bits[i], ra[i] != rb[i]);
+            and_count += ra[i] && rb[i];
+            or_count += ra[i] || rb[i];
+            xor_count += ra[i] != rb[i];
+        }
+        EXPECT_EQ(and_bits.count(), and_count);
+        EXPECT_EQ(or_bits.count(), or_count);
+        EXPECT_EQ(xor_bits.count(), xor_count);
+    }
+    s21::simd::force(original);
+
+    s21::BitVector small(10);
+    s21::BitVector big(11);
+    EXPECT_THROW(small &= big, std::invalid_argument);
+}
+
+TEST(BitVector, CopyAndMove)
+{
+    s21::BitVector bits{true, true, false};
+    s21::BitVector copy;
+    copy = bits;
+    EXPECT_EQ(copy, bits);
+    s21::BitVector moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.count(), 2U);
+    copy = std::move(moved);
+    EXPECT_EQ(copy.size(), 3U);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_NE(copy, s21::BitVector(3));
+}
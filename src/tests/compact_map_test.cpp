@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../map/s21_compact_map.h"
+#include "../map/s21_map.h"
+
+template <typename Map, typename Ref>
+static void expect_same(const Map &m, const Ref &ref)
+{
+    ASSERT_EQ(m.size(), ref.size());
+    auto it = m.begin();
+    for (const auto &item : ref)
+    {
+        ASSERT_TRUE(it != m.end());
+        ASSERT_EQ(it->first, item.first);
+        ASSERT_EQ(it->second, item.second);
+        ++it;
+    }
+    ASSERT_TRUE(it == m.end());
+}
+
+TEST(CompactMap, MapApi)
+{
+    s21::CompactMap<int, std::string> m{{3, "c"}, {1, "a"}, {2, "b"}};
+    EXPECT_EQ(m.size(), 3U);
+    EXPECT_EQ(m.begin()->first, 1);
+    EXPECT_EQ((--m.end())->first, 3);
+    EXPECT_EQ(m.at(2), "b");
+    EXPECT_THROW(m.at(7), std::out_of_range);
+    EXPECT_FALSE(m.insert({2, "x"}).second);
+    EXPECT_FALSE(m.insert_or_assign({2, "x"}).second);
+    EXPECT_EQ(m[2], "x");
+    m[10] = "j";
+    EXPECT_TRUE(m.contains(10));
+    EXPECT_TRUE(m.find(11) == m.end());
+
+    // итератор - номер ячейки, рост массива его не портит
+    auto kept = m.find(10);
+    for (int i = 100; i < 200; ++i)
+    {
+        m.insert({i, "n"});
+    }
+    EXPECT_EQ(kept->second, "j");
+    m.erase(m.find(1));
+    EXPECT_EQ(m.begin()->first, 2);
+
+    s21::CompactMap<int, std::string> other{{2, "dup"}, {5, "e"}};
+    m.merge(other);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_EQ(m.at(5), "e");
+    EXPECT_EQ(m.at(2), "x");
+
+    s21::CompactMap<int, std::string> copy(m);
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.begin() == m.end());
+    EXPECT_EQ(copy.at(150), "n");
+    m = std::move(copy);
+    EXPECT_EQ(m.size(), 104U);
+}
+
+// копирование ключа бросает, когда счётчик доходит до нуля
+struct ThrowingKey
+{
+    static inline int copies_left = -1;
+    std::string text;
+
+    explicit ThrowingKey(std::string s) : text(std::move(s)) {}
+    ThrowingKey(const ThrowingKey &other) : text(other.text)
+    {
+        if (copies_left >= 0 && copies_left-- == 0)
+        {
+            throw std::runtime_error("key copy");
+        }
+    }
+    ThrowingKey(ThrowingKey &&other) noexcept = default;
+    bool operator<(const ThrowingKey &other) const { return text < other.text; }
+};
+
+TEST(CompactMap, EraseWithThrowingKeyCopy)
+{
+    s21::CompactMap<ThrowingKey, int> m;
+    for (int i = 0; i < 50; ++i)
+    {
+        m.insert({ThrowingKey("a fairly long key number " + std::to_string(i)), i});
+    }
+    auto first = m.begin();
+    ThrowingKey::copies_left = 0;
+    EXPECT_THROW(m.erase(first), std::runtime_error);
+    ThrowingKey::copies_left = -1;
+
+    // отказавшее удаление оставляет карту нетронутой
+    ASSERT_EQ(m.size(), 50U);
+    int count = 0;
+    for (auto it = m.begin(); it != m.end(); ++it, ++count)
+    {
+        EXPECT_EQ(it->first.text, "a fairly long key number " + std::to_string(it->second));
+    }
+    EXPECT_EQ(count, 50);
+    while (!m.empty())
+    {
+        m.erase(m.begin());
+    }
+}
+
+TEST(CompactMap, MatchesStdMap)
+{
+    std::mt19937 rng(3);
+    s21::CompactMap<int, int> m;
+    std::map<int, int> ref;
+    for (int step = 0; step < 50000; ++step)
+    {
+        int key = static_cast<int>(rng() % 4000);
+        if (rng() % 3 == 0)
+        {
+            auto it = m.find(key);
+            ASSERT_EQ(it != m.end(), ref.erase(key) == 1);
+            if (it != m.end())
+            {
+                m.erase(it);
+            }
+        }
+        else
+        {
+            ASSERT_EQ(m.insert({key, step}).second, ref.insert({key, step}).second);
+        }
+    }
+    expect_same(m, ref);
+    auto back = m.end();
+    for (auto it = ref.rbegin(); it != ref.rend(); ++it)
+    {
+        --back;
+        ASSERT_EQ(back->first, it->first);
+    }
+    while (!m.empty())
+    {
+        ref.erase(m.begin()->first);
+        m.erase(m.begin());
+    }
+    EXPECT_TRUE(ref.empty());
+}
+
+TEST(CompactMap, Footprint)
+{
+    // 12 байт ссылок и цвета против трёх указателей Tree
+    using Compact = s21::CompactMap<int, int>;
+    using Pair = std::pair<const int, int>;
+    EXPECT_EQ(Compact::node_bytes(), sizeof(Pair) + 3 * sizeof(uint32_t));
+    s21::Map<int, int> tree{{1, 1}};
+    size_t tree_overhead = tree.stats().node_bytes - sizeof(Pair);
+    EXPECT_LE(2 * (Compact::node_bytes() - sizeof(Pair)), tree_overhead);
+
+    // упорядоченная вставка не вырождает дерево: поиск остаётся быстрым
+    s21::CompactMap<int, int> m;
+    m.reserve(1 << 16);
+    for (int i = 0; i < (1 << 16); ++i)
+    {
+        m.insert({i, i});
+    }
+    EXPECT_EQ(m.memory_bytes(), (size_t(1) << 16) * m.node_bytes());
+    for (int i = 0; i < (1 << 16); i += 97)
+    {
+        ASSERT_EQ(m.at(i), i);
+    }
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../parallel/s21_concurrent_vector.h"
+
+TEST(ConcurrentVector, StableIndexAndAddress)
+{
+    s21::ConcurrentVector<std::string> vec;
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.push_back("zero"), 0U);
+    const std::string *first = &vec[0];
+    for (int i = 1; i < 5000; ++i)
+    {
+        ASSERT_EQ(vec.emplace_back(std::to_string(i)), size_t(i));
+    }
+    EXPECT_EQ(&vec[0], first);
+    EXPECT_EQ(vec.at(4999), "4999");
+    EXPECT_EQ(vec.size(), 5000U);
+    EXPECT_GE(vec.capacity(), 5000U);
+    EXPECT_TRUE(vec.published(31));
+    EXPECT_FALSE(vec.published(5000));
+    EXPECT_THROW(vec.at(5000), std::out_of_range);
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.push_back("again"), 0U);
+}
+
+struct ThrowOnNegative
+{
+    explicit ThrowOnNegative(int v) : v(v)
+    {
+        if (v < 0)
+        {
+            throw std::runtime_error("negative");
+        }
+    }
+    int v;
+};
+
+TEST(ConcurrentVector, ThrowingConstructorLeavesHole)
+{
+    s21::ConcurrentVector<ThrowOnNegative> vec;
+    vec.emplace_back(1);
+    EXPECT_THROW(vec.emplace_back(-1), std::runtime_error);
+    EXPECT_EQ(vec.emplace_back(3), 2U);
+    EXPECT_FALSE(vec.published(1));
+    EXPECT_THROW(vec.at(1), std::out_of_range);
+    int visited = 0;
+    vec.for_each([&visited](size_t, const ThrowOnNegative &item)
+                 { visited += item.v; });
+    EXPECT_EQ(visited, 4);
+}
+
+TEST(ConcurrentVector, ParallelAppendAndRead)
+{
+    s21::ConcurrentVector<long long> vec;
+    vec.reserve(1000);
+    EXPECT_GE(vec.capacity(), 1000U);
+    const int threads = 4;
+    const int per_thread = 20000;
+    std::atomic<bool> stop{false};
+    std::thread reader([&]
+                       {
+        while (!stop.load())
+        {
+            size_t n = vec.size();
+            for (size_t i = 0; i < n; i += 101)
+            {
+                if (vec.published(i))
+                {
+                    ASSERT_EQ(vec[i] % 1000003, 7);
+                }
+            }
+            std::this_thread::yield();
+        } });
+    std::vector<std::thread> writers;
+    std::vector<std::vector<size_t>> indices(threads);
+    for (int t = 0; t < threads; ++t)
+    {
+        writers.emplace_back([&, t]
+                             {
+            for (int i = 0; i < per_thread; ++i)
+            {
+                indices[t].push_back(vec.push_back((long long)(t * per_thread + i) * 1000003 + 7));
+            } });
+    }
+    for (auto &w : writers)
+    {
+        w.join();
+    }
+    stop = true;
+    reader.join();
+
+    ASSERT_EQ(vec.size(), size_t(threads * per_thread));
+    std::vector<bool> seen(vec.size());
+    for (int t = 0; t < threads; ++t)
+    {
+        for (int i = 0; i < per_thread; ++i)
+        {
+            size_t index = indices[t][i];
+            ASSERT_EQ(vec[index], (long long)(t * per_thread + i) * 1000003 + 7);
+            ASSERT_FALSE(seen[index]);
+            seen[index] = true;
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../deque/s21_deque.h"
+
+TEST(Deque, PushBackFrontKeepsOrder)
+{
+    s21::Deque<int> dq;
+    std::deque<int> expected;
+    for (int i = 0; i < 5000; ++i)
+    {
+        dq.push_back(i);
+        expected.push_back(i);
+        dq.push_front(-i);
+        expected.push_front(-i);
+    }
+    ASSERT_EQ(dq.size(), expected.size());
+    EXPECT_EQ(dq.front(), expected.front());
+    EXPECT_EQ(dq.back(), expected.back());
+    EXPECT_TRUE(std::equal(dq.begin(), dq.end(), expected.begin(), expected.end()));
+    for (size_t i = 0; i < dq.size(); i += 97)
+    {
+        EXPECT_EQ(dq[i], expected[i]);
+    }
+    EXPECT_EQ(dq.end() - dq.begin(), static_cast<ptrdiff_t>(dq.size()));
+    EXPECT_THROW(dq.at(dq.size()), std::out_of_range);
+}
+
+TEST(Deque, AddressesStableOnGrowth)
+{
+    s21::Deque<std::string> dq{"first"};
+    const std::string *first = &dq.front();
+    std::vector<const std::string *> addresses;
+    for (int i = 0; i < 20000; ++i)
+    {
+        dq.push_back(std::to_string(i));
+        addresses.push_back(&dq.back());
+        dq.emplace_front(i % 10, 'x');
+    }
+    EXPECT_EQ(&dq[20000], first);
+    EXPECT_EQ(*first, "first");
+    for (size_t i = 0; i < addresses.size(); ++i)
+    {
+        ASSERT_EQ(addresses[i], &dq[20001 + i]);
+    }
+}
+
+TEST(Deque, PopAndReuseBlocks)
+{
+    s21::Deque<int> dq;
+    std::deque<int> expected;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 100000; ++i)
+    {
+        switch (rng() % 4)
+        {
+        case 0:
+            dq.push_back(i);
+            expected.push_back(i);
+            break;
+        case 1:
+            dq.push_front(i);
+            expected.push_front(i);
+            break;
+        case 2:
+            if (!expected.empty())
+            {
+                dq.pop_back();
+                expected.pop_back();
+            }
+            break;
+        default:
+            if (!expected.empty())
+            {
+                dq.pop_front();
+                expected.pop_front();
+            }
+        }
+    }
+    ASSERT_EQ(dq.size(), expected.size());
+    EXPECT_TRUE(std::equal(dq.begin(), dq.end(), expected.begin(), expected.end()));
+    dq.shrink_to_fit();
+    EXPECT_TRUE(std::equal(dq.begin(), dq.end(), expected.begin(), expected.end()));
+    dq.clear();
+    EXPECT_TRUE(dq.empty());
+    EXPECT_THROW(dq.pop_front(), std::out_of_range);
+}
+
+TEST(Deque, RandomAccessIterator)
+{
+    s21::Deque<int> dq;
+    for (int i = 0; i < 3000; ++i)
+    {
+        dq.push_front(i);
+    }
+    std::sort(dq.begin(), dq.end());
+    for (int i = 0; i < 3000; ++i)
+    {
+        ASSERT_EQ(dq[i], i);
+    }
+    auto it = dq.begin() + 2500;
+    EXPECT_EQ(*it, 2500);
+    EXPECT_EQ(*(it - 2000), 500);
+    EXPECT_EQ(it[-1], 2499);
+    EXPECT_TRUE(dq.begin() < it);
+    EXPECT_EQ(*std::lower_bound(dq.begin(), dq.end(), 1234), 1234);
+
+    const s21::Deque<int> &cdq = dq;
+    s21::Deque<int>::const_iterator cit = dq.begin();
+    EXPECT_EQ(cit, cdq.begin());
+    EXPECT_EQ(std::distance(cdq.begin(), cdq.end()), 3000);
+}
+
+TEST(Deque, CopyAndMove)
+{
+    s21::Deque<std::string> dq{"a", "b", "c"};
+    s21::Deque<std::string> copy(dq);
+    copy.push_front("z");
+    EXPECT_EQ(dq.size(), 3U);
+    EXPECT_EQ(copy.front(), "z");
+    s21::Deque<std::string> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 4U);
+    dq = moved;
+    EXPECT_EQ(dq[1], "a");
+    copy = std::move(dq);
+    EXPECT_EQ(copy.back(), "c");
+    s21::Deque<int> sized(40);
+    EXPECT_EQ(sized.size(), 40U);
+    EXPECT_EQ(sized[39], 0);
+}
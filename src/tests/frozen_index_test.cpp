@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "../map/s21_map.h"
+#include "../set/s21_set.h"
+
+TEST(FrozenIndex, MatchesMapForEverySize)
+{
+    for (int n = 0; n < 70; ++n)
+    {
+        s21::Map<int, int> m;
+        std::map<int, int> ref;
+        for (int i = 0; i < n; ++i)
+        {
+            int key = (i * 37) % 101 * 2;
+            m.insert({key, i});
+            ref.insert({key, i});
+        }
+        auto frozen = m.freeze();
+        ASSERT_EQ(frozen.size(), ref.size());
+        ASSERT_EQ(frozen.empty(), ref.empty());
+
+        auto it = frozen.begin();
+        for (const auto &item : ref)
+        {
+            ASSERT_EQ(it->first, item.first);
+            ASSERT_EQ(it->second, item.second);
+            ++it;
+        }
+        EXPECT_TRUE(it == frozen.end());
+
+        // чётные ключи есть, нечётные попадают между ними
+        for (int key = -1; key <= 203; ++key)
+        {
+            auto lower = frozen.lower_bound(key);
+            auto expected = ref.lower_bound(key);
+            if (expected == ref.end())
+            {
+                ASSERT_TRUE(lower == frozen.end());
+            }
+            else
+            {
+                ASSERT_EQ(lower->first, expected->first);
+            }
+            ASSERT_EQ(frozen.contains(key), ref.count(key) == 1);
+            if (ref.count(key))
+            {
+                ASSERT_EQ(frozen.at(key), ref[key]);
+                ASSERT_EQ(frozen.find(key)->second, ref[key]);
+            }
+            else
+            {
+                ASSERT_TRUE(frozen.find(key) == frozen.end());
+                ASSERT_THROW(frozen.at(key), std::out_of_range);
+            }
+        }
+    }
+}
+
+TEST(FrozenIndex, SetWithStrings)
+{
+    s21::Set<std::string> s;
+    std::set<std::string> ref;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string key = "key" + std::to_string(rng() % 1000);
+        s.insert(key);
+        ref.insert(key);
+    }
+    auto frozen = s.freeze();
+    ASSERT_EQ(frozen.size(), ref.size());
+    EXPECT_TRUE(std::equal(frozen.begin(), frozen.end(), ref.begin(), ref.end()));
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string key = "key" + std::to_string(i);
+        ASSERT_EQ(frozen.contains(key), ref.count(key) == 1);
+    }
+    EXPECT_EQ(*frozen.lower_bound("a"), *ref.begin());
+    EXPECT_TRUE(frozen.lower_bound("z") == frozen.end());
+
+    // индекс не зависит от исходного множества
+    s.clear();
+    EXPECT_EQ(frozen.size(), ref.size());
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../map/s21_interval_map.h"
+
+using Interval = std::tuple<int, int, int>;
+
+static std::vector<Interval> brute_overlapping(const std::vector<Interval> &all, int a,
+                                               int b)
+{
+    std::vector<Interval> result;
+    for (const auto &item : all)
+    {
+        if (std::get<0>(item) <= b && a <= std::get<1>(item))
+        {
+            result.push_back(item);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename It>
+static std::vector<Interval> collect(const std::vector<It> &found)
+{
+    std::vector<Interval> result;
+    for (const auto &it : found)
+    {
+        result.emplace_back(it->low, it->high, it->value);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(IntervalMap, Basic)
+{
+    s21::IntervalMap<int, int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_THROW(m.insert(5, 4, 0), std::invalid_argument);
+    m.insert(1, 3, 10);
+    m.insert(5, 8, 20);
+    m.insert(2, 6, 30);
+    m.insert(2, 6, 31);
+    EXPECT_EQ(m.size(), 4U);
+
+    EXPECT_EQ(m.stabbing(4).size(), 2U);
+    EXPECT_EQ(m.stabbing(3).size(), 3U);
+    EXPECT_TRUE(m.stabbing(0).empty());
+    EXPECT_TRUE(m.overlapping(9, 100).empty());
+    EXPECT_TRUE(m.overlapping(4, 3).empty());
+    EXPECT_EQ(m.overlapping(8, 8).front()->value, 20);
+
+    // результат идёт по возрастанию low, обход тоже
+    auto found = m.overlapping(0, 10);
+    ASSERT_EQ(found.size(), 4U);
+    EXPECT_EQ(found.front()->low, 1);
+    EXPECT_EQ(found.back()->low, 5);
+    int previous = 0;
+    for (const auto &item : m)
+    {
+        EXPECT_LE(previous, item.low);
+        previous = item.low;
+    }
+
+    m.find(5, 8)->value = 21;
+    EXPECT_EQ(m.stabbing(7).front()->value, 21);
+    EXPECT_TRUE(m.erase(2, 6));
+    EXPECT_FALSE(m.erase(2, 7));
+    EXPECT_EQ(m.stabbing(4).size(), 1U);
+    EXPECT_TRUE(m.find(0, 1) == m.end());
+
+    int sum = 0;
+    m.for_each_overlapping(0, 10, [&sum](auto &item) { sum += item.value; });
+    EXPECT_EQ(sum, 10 + 21 + 31);
+}
+
+TEST(IntervalMap, MatchesBruteForce)
+{
+    std::mt19937 rng(11);
+    s21::IntervalMap<int, int> m;
+    std::vector<Interval> all;
+    for (int step = 0; step < 4000; ++step)
+    {
+        int low = static_cast<int>(rng() % 1000);
+        int high = low + static_cast<int>(rng() % 50);
+        if (rng() % 3 != 0 || all.empty())
+        {
+            m.insert(low, high, step);
+            all.emplace_back(low, high, step);
+        }
+        else
+        {
+            size_t victim = rng() % all.size();
+            auto [vl, vh, vv] = all[victim];
+            auto found = m.overlapping(vl, vl);
+            auto it = std::find_if(found.begin(), found.end(),
+                                   [&](const auto &f)
+                                   { return f->low == vl && f->high == vh && f->value == vv; });
+            ASSERT_TRUE(it != found.end());
+            m.erase(*it);
+            all.erase(all.begin() + victim);
+        }
+        ASSERT_EQ(m.size(), all.size());
+        if (step % 20 == 0)
+        {
+            int a = static_cast<int>(rng() % 1100) - 50;
+            int b = a + static_cast<int>(rng() % 30);
+            ASSERT_EQ(collect(m.overlapping(a, b)), brute_overlapping(all, a, b));
+            ASSERT_EQ(collect(m.stabbing(a)), brute_overlapping(all, a, a));
+        }
+    }
+
+    s21::IntervalMap<int, int> copy(m);
+    m.clear();
+    EXPECT_EQ(collect(copy.overlapping(-100, 2000)), brute_overlapping(all, -100, 2000));
+    m = copy;
+    EXPECT_EQ(m.size(), copy.size());
+    s21::IntervalMap<int, int> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(collect(moved.stabbing(500)), brute_overlapping(all, 500, 500));
+}
+
+TEST(IntervalMap, SortedInsertStaysShallow)
+{
+    // упорядоченные окна: стоимость запроса не растёт линейно
+    s21::IntervalMap<long, int> m;
+    for (long i = 0; i < 100000; ++i)
+    {
+        m.insert(i * 10, i * 10 + 15, static_cast<int>(i));
+    }
+    auto found = m.stabbing(500012);
+    ASSERT_EQ(found.size(), 2U);
+    EXPECT_EQ(found[0]->value, 50000);
+    EXPECT_EQ(found[1]->value, 50001);
+}
@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <map>
+#include <random>
+#include <sstream>
 
 #include "../map/s21_map.h"
+#include "../set/s21_set.h"
 
 using KeyType = int;
 using ValueType = std::string;
@@ -181,3 +185,339 @@ TEST_F(MapTest, EraseNodeWithoutParent) {
   EXPECT_THROW(map.at(2), std::out_of_range);
   EXPECT_EQ(map.at(4), "value4");
 }
+
+TEST_F(MapTest, SaveLoadRoundTrip) {
+  for (int i = 0; i < 1000; ++i) {
+    map.insert({(i * 7919) % 1000, "value" + std::to_string(i)});
+  }
+  std::stringstream stream;
+  map.save(stream);
+
+  MapType loaded;
+  loaded.insert({-1, "stale"});
+  loaded.load(stream);
+  EXPECT_EQ(loaded.size(), map.size());
+  EXPECT_FALSE(loaded.contains(-1));
+  auto it = map.begin();
+  for (auto it2 = loaded.begin(); it2 != loaded.end(); ++it2, ++it) {
+    EXPECT_EQ(it2->first, it->first);
+    EXPECT_EQ(it2->second, it->second);
+  }
+}
+
+TEST_F(MapTest, SaveLoadPodFd) {
+  s21::Map<int, double> pod_map;
+  for (int i = 0; i < 100; ++i) {
+    pod_map.insert({i, i * 1.5});
+  }
+  FILE *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  pod_map.save(fileno(file));
+  pod_map.save(fileno(file));
+  std::rewind(file);
+  lseek(fileno(file), 0, SEEK_SET);
+
+  s21::Map<int, double> first;
+  s21::Map<int, double> second;
+  first.load(fileno(file));
+  second.load(fileno(file));
+  std::fclose(file);
+  EXPECT_EQ(first.size(), 100U);
+  EXPECT_EQ(second.at(99), 99 * 1.5);
+}
+
+// set_test.cpp не собирается, поэтому сериализация Set проверяется здесь
+TEST(SetSerialize, SaveLoadRoundTrip) {
+  s21::Set<std::string> set;
+  for (int i = 0; i < 500; ++i) {
+    set.insert("key" + std::to_string(i));
+  }
+  std::stringstream stream;
+  set.save(stream);
+
+  s21::Set<std::string> loaded;
+  loaded.insert("stale");
+  loaded.load(stream);
+  EXPECT_EQ(loaded.size(), 500U);
+  EXPECT_TRUE(loaded.contains("key42"));
+  EXPECT_FALSE(loaded.contains("key500"));
+  EXPECT_FALSE(loaded.contains("stale"));
+  auto it = set.begin();
+  for (auto it2 = loaded.begin(); it2 != loaded.end(); ++it2, ++it) {
+    ASSERT_EQ(it2->first, it->first);
+  }
+
+  std::stringstream map_stream;
+  s21::Map<std::string, std::string>{{"a", "b"}}.save(map_stream);
+  EXPECT_THROW(loaded.load(map_stream), std::runtime_error);
+}
+
+TEST_F(MapTest, LoadRejectsWrongType) {
+  map.insert({1, "value1"});
+  std::stringstream stream;
+  map.save(stream);
+  s21::Map<int, int> other;
+  EXPECT_THROW(other.load(stream), std::runtime_error);
+  std::stringstream garbage("not a container");
+  EXPECT_THROW(map.load(garbage), std::runtime_error);
+}
+
+TEST_F(MapTest, StatsShape) {
+  s21::Map<int, int> empty;
+  EXPECT_EQ(empty.stats().height, 0U);
+  EXPECT_EQ(empty.height_bound(), 0U);
+
+  // 4 2 6 1 3 5 7 - полное дерево из трёх уровней
+  s21::Map<int, int> full;
+  for (int key : {4, 2, 6, 1, 3, 5, 7}) {
+    full.insert({key, key});
+  }
+  s21::TreeStats stats = full.stats();
+  EXPECT_EQ(stats.nodes, 7U);
+  EXPECT_EQ(stats.height, 3U);
+  EXPECT_EQ(stats.max_depth, 2U);
+  EXPECT_EQ(stats.depth_histogram, (std::vector<size_t>{1, 2, 4}));
+  EXPECT_DOUBLE_EQ(stats.average_depth, 10.0 / 7);
+  EXPECT_DOUBLE_EQ(stats.imbalance, 1.0);
+  EXPECT_GT(stats.node_bytes, stats.payload_bytes);
+  EXPECT_EQ(stats.payload_bytes, 7 * sizeof(std::pair<const int, int>));
+
+  // упорядоченная вставка вырождает дерево в цепочку
+  s21::Map<int, int> chain;
+  for (int i = 0; i < 15; ++i) {
+    chain.insert({i, i});
+  }
+  stats = chain.stats();
+  EXPECT_EQ(stats.height, 15U);
+  EXPECT_DOUBLE_EQ(stats.imbalance, 15.0 / 4);
+}
+
+TEST_F(MapTest, IncrementalHeight) {
+  s21::Map<int, int> m;
+  m.track_height(true);
+  for (int key : {4, 2, 6, 1}) {
+    m.insert({key, key});
+  }
+  EXPECT_EQ(m.height_bound(), 3U);
+  m.insert_or_assign({0, 0});
+  EXPECT_EQ(m.height_bound(), 4U);
+  // удаление оставляет оценку сверху до повторного track_height(true)
+  m.erase(m.find(0));
+  EXPECT_EQ(m.height_bound(), 4U);
+  EXPECT_EQ(m.stats().height, 3U);
+  EXPECT_EQ(m.height_bound(), 4U);
+  m.track_height(true);
+  EXPECT_EQ(m.height_bound(), 3U);
+  m.clear();
+  EXPECT_EQ(m.height_bound(), 0U);
+
+  std::stringstream stream;
+  s21::Map<int, int> sorted;
+  for (int i = 0; i < 100; ++i) {
+    sorted.insert({i, i});
+  }
+  sorted.save(stream);
+  m.load(stream);
+  EXPECT_EQ(m.height_bound(), 7U);
+  EXPECT_EQ(m.stats().height, 7U);
+}
+
+TEST_F(MapTest, CountingTracer) {
+  using s21::trace::Op;
+  s21::Map<int, int, s21::trace::CountingTracer> traced;
+  for (int key : {4, 2, 6, 1}) {
+    traced.insert({key, key});
+  }
+  const auto &tracer = traced.tracer();
+  // insert ищет ключ до и после вставки
+  EXPECT_EQ(tracer.histograms(Op::kFind).visited.count(), 8U);
+  // первый узел становится корнем без спуска
+  EXPECT_EQ(tracer.histograms(Op::kInsert).visited.count(), 3U);
+  EXPECT_EQ(tracer.histograms(Op::kInsert).visited.max(), 2U);
+  EXPECT_EQ(tracer.histograms(Op::kAllocate).nanoseconds.count(), 4U);
+
+  tracer.reset();
+  EXPECT_TRUE(traced.contains(1));
+  const auto &find = tracer.histograms(Op::kFind);
+  EXPECT_EQ(find.visited.max(), 3U);
+  EXPECT_EQ(find.comparisons.max(), 5U);
+  EXPECT_EQ(find.visited.bucket(2), 1U);
+  EXPECT_FALSE(traced.contains(0));
+  EXPECT_EQ(find.comparisons.max(), 6U);
+
+  traced.erase(traced.find(4));
+  EXPECT_EQ(tracer.histograms(Op::kErase).visited.max(), 2U);
+
+  std::stringstream out;
+  tracer.dump(out);
+  EXPECT_NE(out.str().find("find comparisons: n=3"), std::string::npos);
+  EXPECT_NE(out.str().find("erase visited: n=1"), std::string::npos);
+}
+
+TEST_F(MapTest, SamplingTracer) {
+  s21::Map<int, int, s21::trace::SamplingTracer<4>> traced;
+  for (int i = 0; i < 16; ++i) {
+    traced.insert({(i * 7) % 16, i});
+  }
+  for (int i = 0; i < 100; ++i) {
+    traced.contains(i);
+  }
+  const auto &find = traced.tracer().histograms(s21::trace::Op::kFind);
+  EXPECT_EQ(find.visited.count(), (32U + 100U) / 4);
+  EXPECT_EQ(traced.tracer().histograms(s21::trace::Op::kAllocate).nanoseconds.count(), 4U);
+}
+
+TEST_F(MapTest, SelfAdjustingAccess) {
+  for (s21::AccessMode mode :
+       {s21::AccessMode::kSplay, s21::AccessMode::kMoveToRoot}) {
+    s21::Map<int, int, s21::trace::CountingTracer> m;
+    m.set_access_mode(mode);
+    std::map<int, int> ref;
+    for (int i = 0; i < 200; ++i) {
+      int key = (i * 73) % 200;
+      m.insert({key, i});
+      ref.insert({key, i});
+    }
+    std::mt19937 rng(5);
+    for (int step = 0; step < 3000; ++step) {
+      int key = static_cast<int>(rng() % 300);
+      switch (rng() % 3) {
+        case 0:
+          ASSERT_EQ(m.contains(key), ref.count(key) == 1);
+          break;
+        case 1:
+          ASSERT_EQ(m.insert({key, step}).second, ref.insert({key, step}).second);
+          break;
+        default:
+          if (ref.erase(key)) {
+            m.erase(m.find(key));
+          }
+      }
+      ASSERT_EQ(m.size(), ref.size());
+    }
+    auto it = m.begin();
+    for (const auto &item : ref) {
+      ASSERT_EQ(it->first, item.first);
+      ASSERT_EQ(it->second, item.second);
+      ++it;
+    }
+    EXPECT_TRUE(it == m.end());
+
+    // найденный ключ поднят в корень: повторный поиск - один узел
+    int hot = ref.begin()->first;
+    m.find(hot);
+    m.tracer().reset();
+    EXPECT_EQ(m.at(hot), ref[hot]);
+    const auto &find = m.tracer().histograms(s21::trace::Op::kFind);
+    EXPECT_EQ(find.visited.max(), 1U);
+    EXPECT_EQ(find.rotations.max(), 0U);
+    EXPECT_EQ(m.height_bound(), m.stats().height);
+  }
+}
+
+TEST_F(MapTest, HeightBoundAfterRotations) {
+  s21::Map<int, int> m;
+  for (int key : {8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15}) {
+    m.insert({key, key});
+  }
+  m.track_height(true);
+  EXPECT_EQ(m.height_bound(), 4U);
+  m.set_access_mode(s21::AccessMode::kMoveToRoot);
+  for (int key = 1; key <= 15; ++key) {
+    m.find(key);
+  }
+  m.set_access_mode(s21::AccessMode::kStatic);
+  EXPECT_EQ(m.stats().height, 15U);
+  EXPECT_EQ(m.height_bound(), 15U);
+}
+
+TEST_F(MapTest, LookupCache) {
+  EXPECT_THROW(map.set_lookup_cache(8, 3), std::invalid_argument);
+  for (size_t ways : {1, 2}) {
+    s21::Map<int, int> m;
+    m.set_lookup_cache(64, ways);
+    std::map<int, int> ref;
+    for (int i = 0; i < 100; ++i) {
+      m.insert({i, i});
+      ref.insert({i, i});
+    }
+    // вставка ищет ключ дважды: промах до и после создания узла
+    EXPECT_EQ(m.lookup_cache_stats().misses, 200U);
+    m.find(42);
+    auto before = m.lookup_cache_stats();
+    m.find(42);
+    EXPECT_EQ(m.lookup_cache_stats().misses, before.misses);
+    EXPECT_EQ(m.lookup_cache_stats().hits, before.hits + 1);
+
+    // удалённый узел не должен остаться в кэше
+    m.erase(m.find(42));
+    EXPECT_FALSE(m.contains(42));
+    m.insert({42, -1});
+    EXPECT_EQ(m.at(42), -1);
+    ref[42] = -1;
+
+    std::mt19937 rng(9);
+    for (int step = 0; step < 5000; ++step) {
+      int key = static_cast<int>(rng() % 150);
+      if (rng() % 4 == 0) {
+        if (ref.erase(key)) {
+          m.erase(m.find(key));
+        }
+      } else if (rng() % 2 == 0) {
+        ASSERT_EQ(m.insert({key, step}).second, ref.insert({key, step}).second);
+      } else {
+        auto it = m.find(key);
+        ASSERT_EQ(it != m.end(), ref.count(key) == 1);
+        if (it != m.end()) {
+          ASSERT_EQ(it->second, ref[key]);
+        }
+      }
+    }
+    EXPECT_GT(m.lookup_cache_stats().hits, 0U);
+
+    // копия получает пустой кэш той же формы, clear его очищает
+    s21::Map<int, int> copy(m);
+    copy.find(ref.begin()->first);
+    EXPECT_EQ(copy.lookup_cache_stats().misses, 1U);
+    m.clear();
+    EXPECT_FALSE(m.contains(ref.begin()->first));
+    m.set_lookup_cache(0);
+    EXPECT_EQ(m.lookup_cache_stats().hits, 0U);
+  }
+}
+
+TEST_F(MapTest, StringKeyPrefix) {
+  // общие префиксы длиннее 8 байт, короткие ключи, нулевые байты
+  std::vector<std::string> keys = {"", "a", std::string("a\0", 2), "ab",
+                                   "https://example.com/", "https://example.co",
+                                   "https://example.com/a", "https://example.com/b",
+                                   "https://exa", "zzzzzzzzzz", "zzzzzzzz"};
+  std::mt19937 rng(4);
+  for (int i = 0; i < 500; ++i) {
+    keys.push_back("https://example.com/item/" + std::to_string(rng() % 300));
+    keys.push_back("/usr/lib/" + std::to_string(rng() % 50));
+  }
+  s21::Map<std::string, int> prefixed;
+  s21::Map<std::string, int, s21::trace::NoTrace, s21::NoKeyPrefix> plain;
+  std::map<std::string, int> ref;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    int value = static_cast<int>(i);
+    bool inserted = ref.insert({keys[i], value}).second;
+    ASSERT_EQ(prefixed.insert({keys[i], value}).second, inserted);
+    ASSERT_EQ(plain.insert({keys[i], value}).second, inserted);
+  }
+  auto it = prefixed.begin();
+  for (const auto &item : ref) {
+    ASSERT_EQ(it->first, item.first);
+    ASSERT_EQ(prefixed.at(item.first), item.second);
+    ++it;
+  }
+  EXPECT_FALSE(prefixed.contains("https://example.com/item/x"));
+  EXPECT_FALSE(prefixed.contains(std::string("a\0\0", 3)));
+
+  // префикс занимает место только в узлах со строковым ключом
+  auto node = [](const s21::TreeStats &stats) { return stats.node_bytes / stats.nodes; };
+  EXPECT_EQ(node(prefixed.stats()), node(plain.stats()) + sizeof(uint64_t));
+  s21::Map<int, int> ints{{1, 1}};
+  EXPECT_EQ(node(ints.stats()), sizeof(std::pair<const int, int>) + 3 * sizeof(void *));
+}
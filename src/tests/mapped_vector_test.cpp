@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+#include "../vector/s21_mapped_vector.h"
+
+struct Record
+{
+    int id;
+    double value;
+};
+
+class MappedVectorTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() /
+                ("s21_mapped_" + std::to_string(::getpid()) + ".bin"))
+                   .string();
+        std::remove(path.c_str());
+    }
+    void TearDown() override { std::remove(path.c_str()); }
+
+    std::string path;
+};
+
+TEST_F(MappedVectorTest, AppendAndReopen)
+{
+    {
+        s21::MappedVector<Record> vec(path, s21::MapMode::kReadWrite);
+        EXPECT_TRUE(vec.empty());
+        for (int i = 0; i < 10000; ++i)
+        {
+            vec.push_back({i, i * 0.5});
+        }
+        EXPECT_EQ(vec.size(), 10000U);
+        EXPECT_GE(vec.capacity(), 10000U);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 10000 * sizeof(Record));
+
+    const s21::MappedVector<Record> vec(path, s21::MapMode::kReadOnly,
+                                        s21::MapAccess::kSequential);
+    ASSERT_EQ(vec.size(), 10000U);
+    EXPECT_EQ(vec[1234].id, 1234);
+    EXPECT_EQ(vec.at(9999).value, 9999 * 0.5);
+    EXPECT_THROW(vec.at(10000), std::out_of_range);
+    int expected = 0;
+    for (const Record &r : vec)
+    {
+        ASSERT_EQ(r.id, expected++);
+    }
+}
+
+TEST_F(MappedVectorTest, CopyOnWriteLeavesFileIntact)
+{
+    {
+        std::ofstream out(path, std::ios::binary);
+        for (int i = 0; i < 100; ++i)
+        {
+            out.write(reinterpret_cast<const char *>(&i), sizeof(i));
+        }
+    }
+    {
+        s21::MappedVector<int> vec(path, s21::MapMode::kCopyOnWrite,
+                                   s21::MapAccess::kRandom);
+        vec[5] = -1;
+        EXPECT_EQ(vec[5], -1);
+        EXPECT_THROW(vec.push_back(1), std::logic_error);
+    }
+    s21::MappedVector<int> vec(path);
+    EXPECT_EQ(vec.size(), 100U);
+    EXPECT_EQ(vec[5], 5);
+    EXPECT_EQ(*(vec.end() - 1), 99);
+}
+
+TEST_F(MappedVectorTest, ConstElementsAreReadOnly)
+{
+    {
+        s21::MappedVector<int> vec(path, s21::MapMode::kReadWrite);
+        for (int i = 0; i < 10; ++i)
+        {
+            vec.push_back(i);
+        }
+    }
+    s21::MappedVector<const int> vec(path);
+    static_assert(std::is_same_v<decltype(vec[0]), const int &>);
+    static_assert(std::is_same_v<decltype(vec.data()), const int *>);
+    static_assert(std::is_same_v<decltype(vec.begin()), const int *>);
+    ASSERT_EQ(vec.size(), 10U);
+    EXPECT_EQ(vec.at(7), 7);
+    EXPECT_EQ(*(vec.end() - 1), 9);
+    EXPECT_THROW(s21::MappedVector<const int>(path, s21::MapMode::kReadWrite),
+                 std::invalid_argument);
+}
+
+TEST_F(MappedVectorTest, MissingFile)
+{
+    EXPECT_THROW(s21::MappedVector<int> vec(path), std::system_error);
+}
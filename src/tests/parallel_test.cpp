@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../parallel/s21_parallel.h"
+
+static s21::Vector<int> make_data(size_t n)
+{
+    s21::Vector<int> v(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        v[i] = static_cast<int>((i * 2654435761U) % 100003);
+    }
+    return v;
+}
+
+TEST(ThreadPool, task_group)
+{
+    s21::ThreadPool pool(4);
+    s21::TaskGroup group(pool);
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 1000; ++i)
+    {
+        group.run([&counter]
+                  { ++counter; });
+    }
+    group.wait();
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPool, exception)
+{
+    s21::ThreadPool pool(2);
+    s21::TaskGroup group(pool);
+    group.run([]
+              { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+}
+
+TEST(Parallel, sort)
+{
+    s21::ThreadPool pool(4);
+    for (size_t n : {0U, 1U, 100U, 10007U, 200000U})
+    {
+        s21::Vector<int> s21_vec = make_data(n);
+        std::vector<int> std_vec(s21_vec.begin(), s21_vec.end());
+        s21::parallel_sort(s21_vec, std::less<>(), 1000, pool);
+        std::sort(std_vec.begin(), std_vec.end());
+        ASSERT_EQ(s21_vec.size(), std_vec.size());
+        EXPECT_TRUE(std::equal(std_vec.begin(), std_vec.end(), s21_vec.begin()));
+    }
+}
+
+TEST(Parallel, sort_stable)
+{
+    s21::ThreadPool pool(3);
+    s21::Vector<std::pair<int, int>> s21_vec;
+    for (int i = 0; i < 50000; ++i)
+    {
+        s21_vec.push_back({i % 7, i});
+    }
+    auto by_key = [](const auto &a, const auto &b)
+    { return a.first < b.first; };
+    s21::parallel_sort(s21_vec, by_key, 512, pool);
+    for (size_t i = 1; i < s21_vec.size(); ++i)
+    {
+        ASSERT_TRUE(s21_vec[i - 1].first < s21_vec[i].first ||
+                    (s21_vec[i - 1].first == s21_vec[i].first &&
+                     s21_vec[i - 1].second < s21_vec[i].second));
+    }
+}
+
+// без конструктора по умолчанию, с владеющим членом
+struct Keyed
+{
+    explicit Keyed(int k) : key(k), tag(40, static_cast<char>('a' + k % 26)) {}
+    int key;
+    std::string tag;
+};
+
+TEST(Parallel, sort_no_default_ctor)
+{
+    // разные размеры дают чётное и нечётное число проходов слияния
+    for (size_t threads : {2, 3})
+    {
+        s21::ThreadPool pool(threads);
+        for (size_t n : {3000, 9000, 20000})
+        {
+            s21::Vector<Keyed> s21_vec;
+            for (size_t i = 0; i < n; ++i)
+            {
+                s21_vec.push_back(Keyed(static_cast<int>((i * 7919) % 1009)));
+            }
+            s21::parallel_sort(s21_vec, [](const Keyed &a, const Keyed &b)
+                               { return a.key < b.key; }, 256, pool);
+            ASSERT_EQ(s21_vec.size(), n);
+            for (size_t i = 1; i < n; ++i)
+            {
+                ASSERT_LE(s21_vec[i - 1].key, s21_vec[i].key);
+                ASSERT_EQ(s21_vec[i].tag[0], 'a' + s21_vec[i].key % 26);
+            }
+        }
+    }
+}
+
+TEST(Parallel, for_transform_reduce)
+{
+    s21::ThreadPool pool(4);
+    s21::Vector<int> s21_vec = make_data(100000);
+    std::vector<int> std_vec(s21_vec.begin(), s21_vec.end());
+
+    s21::parallel_for(s21_vec, [](int &x)
+                      { x *= 2; }, 1000, pool);
+    s21::Vector<long long> squares;
+    s21::parallel_transform(s21_vec, squares, [](int x)
+                            { return (long long)x * x; }, 1000, pool);
+    long long sum = s21::parallel_reduce(squares, 0LL, std::plus<>(), 1000, pool);
+
+    long long expected = 0;
+    for (int x : std_vec)
+    {
+        expected += 4LL * x * x;
+    }
+    EXPECT_EQ(squares.size(), s21_vec.size());
+    EXPECT_EQ(s21_vec[10], std_vec[10] * 2);
+    EXPECT_EQ(sum, expected);
+    EXPECT_EQ(s21::parallel_reduce(s21::Vector<int>(), 5, std::plus<>(), 1000, pool), 5);
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../parallel/s21_ring.h"
+#include "../queue/s21_queue.h"
+#include "../stack/s21_stack.h"
+
+TEST(Queue, FifoOrder)
+{
+    s21::Queue<std::string> queue{"a", "b"};
+    for (int i = 0; i < 1000; ++i)
+    {
+        queue.push(std::to_string(i));
+        if (i % 3 == 0)
+        {
+            queue.pop();
+        }
+    }
+    EXPECT_EQ(queue.size(), 668U);
+    EXPECT_EQ(queue.front(), "332");
+    EXPECT_EQ(queue.back(), "999");
+    queue.emplace(3, 'z');
+    EXPECT_EQ(queue.back(), "zzz");
+    while (!queue.empty())
+    {
+        queue.pop();
+    }
+    EXPECT_THROW(queue.pop(), std::out_of_range);
+    EXPECT_THROW(queue.front(), std::out_of_range);
+}
+
+TEST(Queue, RingBufferWrapsAndGrows)
+{
+    s21::RingBuffer<int> ring;
+    ring.reserve(5);
+    EXPECT_EQ(ring.capacity(), 8U);
+    for (int i = 0; i < 6; ++i)
+    {
+        ring.push_back(i);
+    }
+    ring.pop_front();
+    ring.pop_front();
+    ring.push_back(6);
+    ring.push_back(7);
+    ring.push_front(1);
+    EXPECT_EQ(ring.capacity(), 8U);
+    ring.push_back(8);
+    ring.push_back(ring[0]);
+    EXPECT_EQ(ring.capacity(), 16U);
+    ASSERT_EQ(ring.size(), 9U);
+    const int expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 1};
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(ring[i], expected[i]);
+    }
+    s21::RingBuffer<int> copy(ring);
+    ring.clear();
+    EXPECT_EQ(copy.front(), 1);
+    EXPECT_EQ(copy.back(), 1);
+    EXPECT_THROW(ring.pop_back(), std::out_of_range);
+}
+
+TEST(Stack, LifoOrder)
+{
+    s21::Stack<int> stack{1, 2, 3};
+    stack.push(4);
+    EXPECT_EQ(stack.top(), 4);
+    stack.top() = 40;
+    stack.pop();
+    const s21::Stack<int> &cstack = stack;
+    EXPECT_EQ(cstack.top(), 3);
+    EXPECT_EQ(stack.size(), 3U);
+
+    s21::Stack<std::string, s21::RingBuffer<std::string>> ring_stack;
+    ring_stack.emplace("x");
+    ring_stack.push("y");
+    EXPECT_EQ(ring_stack.top(), "y");
+    ring_stack.pop();
+    ring_stack.pop();
+    EXPECT_THROW(ring_stack.pop(), std::out_of_range);
+    EXPECT_THROW(ring_stack.top(), std::out_of_range);
+}
+
+TEST(SpscRing, TwoThreads)
+{
+    s21::SpscRing<std::string> ring(100);
+    EXPECT_EQ(ring.capacity(), 128U);
+    const int n = 20000;
+    std::thread producer([&ring]
+                         {
+        for (int i = 0; i < n;)
+        {
+            if (i % 7 == 0)
+            {
+                std::string batch[3] = {std::to_string(i), std::to_string(i + 1),
+                                        std::to_string(i + 2)};
+                i += ring.push_batch(batch, std::min(3, n - i));
+            }
+            else if (ring.try_push(std::to_string(i)))
+            {
+                ++i;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        } });
+    int expected = 0;
+    std::string buffer[16];
+    while (expected < n)
+    {
+        size_t got = ring.pop_batch(buffer, 16);
+        if (got == 0)
+        {
+            std::this_thread::yield();
+        }
+        for (size_t k = 0; k < got; ++k)
+        {
+            ASSERT_EQ(buffer[k], std::to_string(expected++));
+        }
+    }
+    producer.join();
+    std::string out;
+    EXPECT_FALSE(ring.try_pop(out));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(MpmcRing, ManyProducersAndConsumers)
+{
+    s21::MpmcRing<int> ring(64);
+    const int producers = 4;
+    const int consumers = 4;
+    const int per_producer = 20000;
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&ring, p]
+                             {
+            int values[4];
+            for (int i = 0; i < per_producer;)
+            {
+                int count = std::min(4, per_producer - i);
+                for (int k = 0; k < count; ++k)
+                {
+                    values[k] = p * per_producer + i + k;
+                }
+                size_t pushed = ring.push_batch(values, count);
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+                i += int(pushed);
+            } });
+    }
+    for (int c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&, c]
+                             {
+            int values[8];
+            while (received.load() < producers * per_producer)
+            {
+                size_t got = ring.pop_batch(values, c % 2 ? 8 : 1);
+                if (got == 0)
+                {
+                    std::this_thread::yield();
+                }
+                for (size_t k = 0; k < got; ++k)
+                {
+                    sum += values[k];
+                }
+                received += int(got);
+            } });
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+    long long total = (long long)producers * per_producer;
+    EXPECT_EQ(received.load(), total);
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+    EXPECT_TRUE(ring.empty());
+
+    s21::MpmcRing<std::string> strings(2);
+    EXPECT_TRUE(strings.try_push("a"));
+    EXPECT_TRUE(strings.try_emplace(2, 'b'));
+    EXPECT_FALSE(strings.try_push("c"));
+    std::string out;
+    EXPECT_TRUE(strings.try_pop(out));
+    EXPECT_EQ(out, "a");
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../map/s21_radix_map.h"
+
+template <typename Map, typename Ref>
+static void expect_same(const Map &m, const Ref &ref)
+{
+    ASSERT_EQ(m.size(), ref.size());
+    auto it = m.begin();
+    for (const auto &item : ref)
+    {
+        ASSERT_TRUE(it != m.end());
+        ASSERT_EQ(it->first, item.first);
+        ASSERT_EQ(it->second, item.second);
+        ++it;
+    }
+    ASSERT_TRUE(it == m.end());
+}
+
+TEST(RadixMap, MapApi)
+{
+    s21::RadixMap<int, std::string> m{{3, "c"}, {-1, "a"}, {2, "b"}};
+    EXPECT_EQ(m.size(), 3U);
+    EXPECT_EQ(m.begin()->first, -1);
+    EXPECT_EQ((--m.end())->first, 3);
+    EXPECT_EQ(m.at(2), "b");
+    EXPECT_THROW(m.at(7), std::out_of_range);
+    EXPECT_FALSE(m.insert({2, "x"}).second);
+    EXPECT_FALSE(m.insert_or_assign({2, "x"}).second);
+    EXPECT_EQ(m[2], "x");
+    m[10] = "j";
+    EXPECT_TRUE(m.contains(10));
+    EXPECT_TRUE(m.find(11) == m.end());
+    m.erase(m.find(-1));
+    EXPECT_EQ(m.begin()->first, 2);
+
+    s21::RadixMap<int, std::string> other{{2, "dup"}, {5, "e"}};
+    m.merge(other);
+    EXPECT_EQ(m.size(), 4U);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_EQ(m.at(2), "x");
+
+    auto results = m.insert_many(std::make_pair(6, std::string("f")),
+                                 std::make_pair(5, std::string("e")));
+    EXPECT_TRUE(results[0].second);
+    EXPECT_FALSE(results[1].second);
+
+    s21::RadixMap<int, std::string> copy(m);
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(copy.size(), 5U);
+    m = std::move(copy);
+    EXPECT_EQ(m.size(), 5U);
+}
+
+TEST(RadixMap, IntegersMatchStdMap)
+{
+    std::mt19937_64 rng(1);
+    for (uint64_t spread : {uint64_t(300), uint64_t(70000), ~uint64_t(0)})
+    {
+        s21::RadixMap<int64_t, int> m;
+        std::map<int64_t, int> ref;
+        for (int step = 0; step < 20000; ++step)
+        {
+            int64_t key = static_cast<int64_t>(rng() % spread);
+            if (spread < 100000)
+            {
+                key -= static_cast<int64_t>(spread / 2);
+            }
+            if (rng() % 3 == 0)
+            {
+                auto it = m.find(key);
+                ASSERT_EQ(it != m.end(), ref.erase(key) == 1);
+                if (it != m.end())
+                {
+                    m.erase(it);
+                }
+            }
+            else
+            {
+                ASSERT_EQ(m.insert({key, step}).second, ref.insert({key, step}).second);
+            }
+        }
+        expect_same(m, ref);
+        for (const auto &item : ref)
+        {
+            ASSERT_EQ(m.at(item.first), item.second);
+        }
+        // спуск до пустого дерева через все сжатия узлов
+        while (!m.empty())
+        {
+            ref.erase(m.begin()->first);
+            m.erase(m.begin());
+        }
+        EXPECT_TRUE(ref.empty());
+    }
+}
+
+static std::string url(std::mt19937 &rng)
+{
+    static const char *hosts[] = {"https://example.com/", "https://example.org/",
+                                  "http://a.io/", "https://example.com/api/v1/"};
+    std::string result = hosts[rng() % 4];
+    int parts = static_cast<int>(rng() % 4);
+    for (int i = 0; i < parts; ++i)
+    {
+        result += "p" + std::to_string(rng() % 20);
+        if (i + 1 < parts)
+        {
+            result += '/';
+        }
+    }
+    return result;
+}
+
+TEST(RadixMap, StringsAndPrefixes)
+{
+    std::mt19937 rng(2);
+    s21::RadixMap<std::string, int> m;
+    std::map<std::string, int> ref;
+    for (int step = 0; step < 30000; ++step)
+    {
+        std::string key = url(rng);
+        if (rng() % 4 == 0)
+        {
+            key = key.substr(0, rng() % (key.size() + 1));
+        }
+        if (rng() % 3 == 0)
+        {
+            auto it = m.find(key);
+            ASSERT_EQ(it != m.end(), ref.erase(key) == 1);
+            if (it != m.end())
+            {
+                m.erase(it);
+            }
+        }
+        else
+        {
+            ASSERT_EQ(m.insert({key, step}).second, ref.insert({key, step}).second);
+        }
+    }
+    expect_same(m, ref);
+    EXPECT_TRUE(m.contains("") == (ref.count("") == 1));
+
+    for (std::string prefix : {"", "h", "https://example.com/", "https://example.com/api",
+                               "https://example.com/p1", "http://a.io/p3/p", "ftp", "https://z"})
+    {
+        auto range = m.prefix_range(prefix);
+        auto expected = ref.lower_bound(prefix);
+        for (auto it = range.first; it != range.second; ++it, ++expected)
+        {
+            ASSERT_TRUE(expected != ref.end());
+            ASSERT_EQ(it->first, expected->first);
+        }
+        ASSERT_TRUE(expected == ref.end() ||
+                    expected->first.compare(0, prefix.size(), prefix) != 0)
+            << prefix;
+    }
+
+    // длинные общие префиксы (больше сохраняемых в узле байт)
+    s21::RadixMap<std::string, int> deep;
+    std::map<std::string, int> deep_ref;
+    std::string base(40, 'x');
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string key = base.substr(0, rng() % 40) + std::to_string(rng() % 50) +
+                          base.substr(0, rng() % 20);
+        deep[key] = i;
+        deep_ref[key] = i;
+        if (i % 3 == 0)
+        {
+            std::string victim = deep_ref.begin()->first;
+            deep.erase(deep.find(victim));
+            deep_ref.erase(victim);
+        }
+    }
+    expect_same(deep, deep_ref);
+    auto range = deep.prefix_range(base.substr(0, 30));
+    size_t count = 0;
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        ++count;
+    }
+    size_t expected = 0;
+    for (const auto &item : deep_ref)
+    {
+        expected += item.first.compare(0, 30, base.substr(0, 30)) == 0;
+    }
+    EXPECT_EQ(count, expected);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "../vector/s21_soa_vector.h"
+
+TEST(SoAVector, PushBackAndRows)
+{
+    s21::SoAVector<int, double, std::string> table;
+    EXPECT_TRUE(table.empty());
+    for (int i = 0; i < 1000; ++i)
+    {
+        table.push_back({i, i * 0.5, std::to_string(i)});
+    }
+    table.emplace_back(1000, 500.0, "1000");
+    ASSERT_EQ(table.size(), 1001U);
+    EXPECT_GE(table.capacity(), table.size());
+
+    auto [id, value, name] = table[42];
+    EXPECT_EQ(id, 42);
+    EXPECT_EQ(value, 21.0);
+    EXPECT_EQ(name, "42");
+    value = -1.0;
+    EXPECT_EQ(table.column<1>()[42], -1.0);
+
+    auto last = table.back();
+    EXPECT_EQ(std::get<2>(last), "1000");
+    EXPECT_THROW(table.at(1001), std::out_of_range);
+
+    int expected = 0;
+    for (auto row : table)
+    {
+        ASSERT_EQ(std::get<0>(row), expected++);
+    }
+}
+
+TEST(SoAVector, ColumnsAreContiguous)
+{
+    s21::SoAVector<int, float> table;
+    table.reserve(64);
+    EXPECT_GE(table.capacity(), 64U);
+    for (int i = 0; i < 100; ++i)
+    {
+        table.emplace_back(i, 1.0f);
+    }
+    s21::Span<int> ids = table.column<0>();
+    ASSERT_EQ(ids.size(), 100U);
+    EXPECT_EQ(ids.data(), table.data<0>());
+    EXPECT_EQ(&ids[99], ids.data() + 99);
+    EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 4950);
+
+    const auto &ctable = table;
+    s21::Span<const float> weights = ctable.column<1>();
+    EXPECT_EQ(std::accumulate(weights.begin(), weights.end(), 0.0f), 100.0f);
+}
+
+TEST(SoAVector, EraseAndResize)
+{
+    s21::SoAVector<int, std::string> table;
+    for (int i = 0; i < 10; ++i)
+    {
+        table.emplace_back(i, std::string(i, 'x'));
+    }
+    table.erase(0);
+    table.erase(2, 5);
+    ASSERT_EQ(table.size(), 6U);
+    EXPECT_EQ(std::get<0>(table[0]), 1);
+    EXPECT_EQ(std::get<0>(table[2]), 6);
+    EXPECT_EQ(std::get<1>(table[2]), "xxxxxx");
+    EXPECT_THROW(table.erase(5, 7), std::out_of_range);
+
+    table.pop_back();
+    EXPECT_EQ(std::get<0>(table.back()), 8);
+    table.resize(10);
+    EXPECT_EQ(table.size(), 10U);
+    EXPECT_EQ(std::get<1>(table[9]), "");
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_THROW(table.pop_back(), std::out_of_range);
+}
+
+struct Throwing
+{
+    Throwing(int v) : v(v)
+    {
+        if (v < 0)
+        {
+            throw std::runtime_error("negative");
+        }
+    }
+    int v;
+};
+
+TEST(SoAVector, EmplaceRollsBackOnThrow)
+{
+    s21::SoAVector<std::string, Throwing> table;
+    table.emplace_back("ok", 1);
+    EXPECT_THROW(table.emplace_back("bad", -1), std::runtime_error);
+    ASSERT_EQ(table.size(), 1U);
+    EXPECT_EQ(table.column<0>().size(), 1U);
+    EXPECT_EQ(table.column<1>().size(), 1U);
+}
+
+TEST(SoAVector, EmplaceFromOwnRowWhileGrowing)
+{
+    s21::SoAVector<std::string, int> table;
+    table.emplace_back(std::string(40, 'a'), 1);
+    for (int i = 0; i < 5; ++i)
+    {
+        // строка-источник переезжает при росте столбцов
+        table.emplace_back(std::get<0>(table[0]), std::get<1>(table[0]) + i);
+    }
+    table.push_back(table[1]);
+    ASSERT_EQ(table.size(), 7U);
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        EXPECT_EQ(std::get<0>(table[i]), std::string(40, 'a'));
+    }
+    EXPECT_EQ(std::get<1>(table[5]), 5);
+    EXPECT_EQ(std::get<1>(table[6]), 1);
+}
@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <sstream>
 #include <vector>
 
 #include "../vector/s21_vector.h"
+#include "../vector/s21_vector_simd.h"
 
 TEST(Vector_constructor, case1)
 {
@@ -548,6 +551,397 @@ TEST(Vector_erase, case2)
     EXPECT_EQ(s21_vec_string[0], "Hello");
 }
 
+TEST(Vector_insert_range, case1)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 8, 9};
+    s21::Vector<std::string> s21_vec_string{"Hello", "!"};
+    std::vector<int> src_int{5, 6, 7};
+    std::vector<std::string> src_string{",", "world"};
+
+    auto it_int = s21_vec_int.insert(s21_vec_int.begin() + 2, src_int.begin(),
+                                     src_int.end());
+    auto it_string = s21_vec_string.insert(s21_vec_string.begin() + 1,
+                                           src_string.begin(), src_string.end());
+
+    std::vector<int> std_vec_int{1, 4, 5, 6, 7, 8, 9};
+    std::vector<std::string> std_vec_string{"Hello", ",", "world", "!"};
+    EXPECT_EQ(*it_int, 5);
+    EXPECT_EQ(*it_string, ",");
+    ASSERT_EQ(s21_vec_int.size(), std_vec_int.size());
+    ASSERT_EQ(s21_vec_string.size(), std_vec_string.size());
+    for (size_t i = 0; i < std_vec_int.size(); ++i)
+    {
+        EXPECT_EQ(s21_vec_int[i], std_vec_int[i]);
+    }
+    for (size_t i = 0; i < std_vec_string.size(); ++i)
+    {
+        EXPECT_EQ(s21_vec_string[i], std_vec_string[i]);
+    }
+}
+
+TEST(Vector_insert_range, case2)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 8, 9};
+    s21::Vector<std::string> s21_vec_string{"Hello", "!"};
+
+    s21_vec_int.reserve(10);
+    s21_vec_string.reserve(10);
+    s21_vec_int.insert(s21_vec_int.begin() + 1, 3, 0);
+    s21_vec_string.insert(s21_vec_string.end(), 2, "?");
+
+    std::vector<int> std_vec_int{1, 0, 0, 0, 4, 8, 9};
+    std::vector<std::string> std_vec_string{"Hello", "!", "?", "?"};
+    EXPECT_EQ(s21_vec_int.capacity(), 10U);
+    ASSERT_EQ(s21_vec_int.size(), std_vec_int.size());
+    ASSERT_EQ(s21_vec_string.size(), std_vec_string.size());
+    for (size_t i = 0; i < std_vec_int.size(); ++i)
+    {
+        EXPECT_EQ(s21_vec_int[i], std_vec_int[i]);
+    }
+    for (size_t i = 0; i < std_vec_string.size(); ++i)
+    {
+        EXPECT_EQ(s21_vec_string[i], std_vec_string[i]);
+    }
+}
+
+TEST(Vector_insert_range, case3)
+{
+    s21::Vector<int> s21_vec_int{1, 2, 3};
+
+    s21_vec_int.insert(s21_vec_int.begin(), 2, s21_vec_int[2]);
+    s21_vec_int.push_back(s21_vec_int[0]);
+
+    std::vector<int> std_vec_int{3, 3, 1, 2, 3, 3};
+    ASSERT_EQ(s21_vec_int.size(), std_vec_int.size());
+    for (size_t i = 0; i < std_vec_int.size(); ++i)
+    {
+        EXPECT_EQ(s21_vec_int[i], std_vec_int[i]);
+    }
+}
+
+// копирование бросает, когда счётчик доходит до нуля
+struct ThrowingCopy
+{
+    static inline int copies_left = -1;
+    std::string text;
+
+    explicit ThrowingCopy(const char *s) : text(s) {}
+    ThrowingCopy(const ThrowingCopy &other) : text(other.text)
+    {
+        if (copies_left >= 0 && copies_left-- == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+    }
+    ThrowingCopy(ThrowingCopy &&other) noexcept = default;
+    ThrowingCopy &operator=(const ThrowingCopy &) = default;
+};
+
+TEST(Vector_insert_range, case4)
+{
+    const char *long_text = "a string long enough to live on the heap";
+    for (size_t spare : {0, 10})
+    {
+        s21::Vector<ThrowingCopy> vec;
+        vec.reserve(3 + spare);
+        for (const char *s : {"x", "y", "z"})
+        {
+            vec.emplace_back(s);
+        }
+        std::vector<ThrowingCopy> src(4, ThrowingCopy(long_text));
+
+        ThrowingCopy::copies_left = 2;
+        EXPECT_THROW(vec.insert(vec.begin() + 1, src.begin(), src.end()), std::runtime_error);
+        ThrowingCopy::copies_left = 2;
+        EXPECT_THROW(vec.insert(vec.begin() + 1, 4, src[0]), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+
+        ASSERT_EQ(vec.size(), 3U);
+        EXPECT_EQ(vec[0].text, "x");
+        EXPECT_EQ(vec[1].text, "y");
+        EXPECT_EQ(vec[2].text, "z");
+    }
+}
+
+TEST(Vector_erase_range, case1)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 1, 8, 9};
+    s21::Vector<std::string> s21_vec_string{"Hello", ",", "", "world", "!"};
+
+    auto it_int = s21_vec_int.erase(s21_vec_int.begin() + 1,
+                                    s21_vec_int.begin() + 3);
+    auto it_string = s21_vec_string.erase(s21_vec_string.begin() + 1,
+                                          s21_vec_string.begin() + 3);
+
+    EXPECT_EQ(*it_int, 8);
+    EXPECT_EQ(*it_string, "world");
+    EXPECT_EQ(s21_vec_int.size(), 3U);
+    EXPECT_EQ(s21_vec_int.capacity(), 5U);
+    EXPECT_EQ(s21_vec_int[2], 9);
+    EXPECT_EQ(s21_vec_string.size(), 3U);
+    EXPECT_EQ(s21_vec_string[2], "!");
+}
+
+TEST(Vector_assign, case1)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 8, 9};
+    s21::Vector<std::string> s21_vec_string{"Hello", ",", "world", "!"};
+
+    s21_vec_int.assign(2, 7);
+    s21_vec_string.assign({"a", "b", "c", "d", "e"});
+
+    EXPECT_EQ(s21_vec_int.size(), 2U);
+    EXPECT_EQ(s21_vec_int.capacity(), 4U);
+    EXPECT_EQ(s21_vec_int[1], 7);
+    EXPECT_EQ(s21_vec_string.size(), 5U);
+    EXPECT_EQ(s21_vec_string[4], "e");
+}
+
+TEST(Vector_resize, case1)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 8, 9};
+    s21::Vector<std::string> s21_vec_string{"Hello", ",", "world", "!"};
+
+    s21_vec_int.resize(6);
+    s21_vec_string.resize(6, "?");
+
+    EXPECT_EQ(s21_vec_int.size(), 6U);
+    EXPECT_EQ(s21_vec_int[3], 9);
+    EXPECT_EQ(s21_vec_int[5], 0);
+    EXPECT_EQ(s21_vec_string.size(), 6U);
+    EXPECT_EQ(s21_vec_string[5], "?");
+
+    s21_vec_int.resize(1);
+    s21_vec_string.resize(1);
+
+    EXPECT_EQ(s21_vec_int.size(), 1U);
+    EXPECT_EQ(s21_vec_int[0], 1);
+    EXPECT_EQ(s21_vec_string.size(), 1U);
+    EXPECT_EQ(s21_vec_string[0], "Hello");
+}
+
+TEST(Vector_growth, case1)
+{
+    s21::Vector<int> s21_vec_double_growth;
+    s21::Vector<int, s21::GrowHalf> s21_vec_half_growth;
+    s21::Vector<int, s21::GrowChunk<16>> s21_vec_chunk_growth;
+
+    for (int i = 0; i < 33; ++i)
+    {
+        s21_vec_double_growth.push_back(i);
+        s21_vec_half_growth.push_back(i);
+        s21_vec_chunk_growth.push_back(i);
+    }
+
+    EXPECT_EQ(s21_vec_double_growth.capacity(), 64U);
+    EXPECT_EQ(s21_vec_half_growth.capacity(), 42U);
+    EXPECT_EQ(s21_vec_chunk_growth.capacity(), 48U);
+    EXPECT_EQ(s21_vec_half_growth[32], 32);
+    EXPECT_EQ(s21_vec_chunk_growth[32], 32);
+}
+
+TEST(Vector_growth, case2)
+{
+    // буфер переходит порог отображения страницами и растёт через mremap
+    s21::Vector<long long, s21::GrowHalf> s21_vec;
+    const long long n = 1 << 19;
+    for (long long i = 0; i < n; ++i)
+    {
+        s21_vec.push_back(i);
+    }
+    s21_vec.insert(s21_vec.begin() + 1, 3, -1);
+    s21_vec.erase(s21_vec.begin() + 1, s21_vec.begin() + 4);
+    s21_vec.resize(n / 2);
+    s21_vec.shrink_to_fit();
+
+    ASSERT_EQ(s21_vec.size(), size_t(n / 2));
+    for (long long i = 0; i < n / 2; ++i)
+    {
+        ASSERT_EQ(s21_vec[i], i);
+    }
+}
+
+TEST(Vector_pool, case1)
+{
+    using PooledVector = s21::Vector<int, s21::GrowDouble, s21::PooledMemory>;
+    auto &pool = s21::vector_memory::BufferPool::local();
+    pool.trim();
+    pool.reset_stats();
+
+    for (int round = 0; round < 10; ++round)
+    {
+        PooledVector s21_vec_int(100);
+        s21::Vector<std::string, s21::GrowDouble, s21::PooledMemory> s21_vec_string{
+            "Hello", ",", "world", "!"};
+        s21_vec_int.push_back(round);
+        EXPECT_EQ(s21_vec_int[100], round);
+        EXPECT_EQ(s21_vec_string[2], "world");
+    }
+
+    auto stats = pool.stats();
+    EXPECT_EQ(stats.misses, 3U);
+    EXPECT_EQ(stats.hits, 27U);
+    EXPECT_GT(pool.cached_bytes(), 0U);
+    pool.trim();
+    EXPECT_EQ(pool.cached_bytes(), 0U);
+}
+
+TEST(Vector_simd, case1)
+{
+    const s21::simd::Level levels[] = {s21::simd::Level::kScalar,
+                                       s21::simd::Level::kSse4,
+                                       s21::simd::Level::kAvx2};
+    for (auto level : levels)
+    {
+        s21::simd::force(level);
+        for (size_t n : {1U, 7U, 8U, 33U, 1000U})
+        {
+            s21::Vector<int32_t> s21_vec_int;
+            s21::Vector<float> s21_vec_float;
+            for (size_t i = 0; i < n; ++i)
+            {
+                int32_t x = static_cast<int32_t>((i * 2654435761U) % 97) - 48;
+                s21_vec_int.push_back(x);
+                s21_vec_float.push_back(x * 0.5f);
+            }
+            s21::Vector<int32_t> s21_vec_int_copy(s21_vec_int);
+            s21::Vector<float> s21_vec_float_copy(s21_vec_float);
+            const int32_t *p = s21_vec_int.data();
+            const float *q = s21_vec_float.data();
+
+            for (int32_t x : {-48, 0, 17, 100})
+            {
+                EXPECT_EQ(s21::find(s21_vec_int, x), s21::simd::scalar::find(p, n, x));
+                EXPECT_EQ(s21::count(s21_vec_int, x), s21::simd::scalar::count(p, n, x));
+                EXPECT_EQ(s21::contains(s21_vec_float, x * 0.5f),
+                          s21::simd::scalar::find(q, n, x * 0.5f) != q + n);
+                EXPECT_EQ(s21::count(s21_vec_float, x * 0.5f),
+                          s21::simd::scalar::count(q, n, x * 0.5f));
+            }
+            EXPECT_EQ(s21::sum(s21_vec_int), s21::simd::scalar::sum(p, n));
+            EXPECT_DOUBLE_EQ(s21::sum(s21_vec_float), s21::simd::scalar::sum(q, n));
+            EXPECT_EQ(s21::min_max(s21_vec_int), s21::simd::scalar::min_max(p, n));
+            EXPECT_EQ(s21::min_max(s21_vec_float), s21::simd::scalar::min_max(q, n));
+            EXPECT_TRUE(s21::equal(s21_vec_int, s21_vec_int_copy));
+            EXPECT_TRUE(s21::equal(s21_vec_float, s21_vec_float_copy));
+            s21_vec_int_copy[n - 1] += 1;
+            s21_vec_float_copy[n - 1] += 1.0f;
+            EXPECT_FALSE(s21::equal(s21_vec_int, s21_vec_int_copy));
+            EXPECT_FALSE(s21::equal(s21_vec_float, s21_vec_float_copy));
+        }
+    }
+    s21::simd::force(s21::simd::detect());
+}
+
+TEST(Vector_simd, case2)
+{
+    s21::Vector<int32_t> s21_vec_int;
+    s21::Vector<double> s21_vec_double{1.5, -2.0, 3.25};
+
+    EXPECT_THROW(s21::min_max(s21_vec_int), std::out_of_range);
+    EXPECT_FALSE(s21::contains(s21_vec_int, 0));
+    EXPECT_EQ(s21::sum(s21_vec_int), 0);
+    EXPECT_DOUBLE_EQ(s21::sum(s21_vec_double), 2.75);
+    EXPECT_EQ(s21::min_max(s21_vec_double), std::make_pair(-2.0, 3.25));
+}
+
+TEST(Vector_simd, case3)
+{
+    // искомое значение другого типа приводится к типу элемента
+    s21::Vector<float> s21_vec_float{0.5f, 1.0f, 1.0f};
+    s21::Vector<int> s21_vec_int{5, 7, 5};
+
+    EXPECT_EQ(s21::find(s21_vec_float, 1.0), s21_vec_float.begin() + 1);
+    EXPECT_EQ(s21::count(s21_vec_float, 1.0), 2U);
+    EXPECT_TRUE(s21::contains(s21_vec_float, 0.5));
+    EXPECT_EQ(s21::count(s21_vec_int, 5u), 2U);
+    EXPECT_EQ(s21::find(s21_vec_int, 7L), s21_vec_int.begin() + 1);
+    EXPECT_FALSE(s21::contains(s21_vec_int, 6u));
+}
+
+TEST(Vector_save_load, case1)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 8, 9};
+    s21::Vector<std::string> s21_vec_string{"Hello", ",", "world", "!"};
+    std::stringstream stream;
+
+    s21_vec_int.save(stream);
+    s21_vec_string.save(stream);
+    s21::Vector<int> s21_res_int{7};
+    s21::Vector<std::string> s21_res_string;
+    s21_res_int.load(stream);
+    s21_res_string.load(stream);
+
+    EXPECT_EQ(s21_res_int.size(), 4U);
+    EXPECT_EQ(s21_res_int[3], 9);
+    EXPECT_EQ(s21_res_string.size(), 4U);
+    EXPECT_EQ(s21_res_string[2], "world");
+    EXPECT_THROW(s21_res_int.load(stream), std::runtime_error);
+}
+
+TEST(Vector_save_load, case2)
+{
+    // испорченный счётчик в заголовке (смещение 16) или длина строки
+    // (сразу после заголовка) не должны приводить к огромному выделению
+    const uint64_t huge = uint64_t(1) << 40;
+    s21::Vector<int> s21_vec_int(100000);
+    s21::Vector<std::string> s21_vec_string{"Hello"};
+    std::stringstream int_stream;
+    std::stringstream string_stream;
+    s21_vec_int.save(int_stream);
+    s21_vec_string.save(string_stream);
+    std::string int_bytes = int_stream.str();
+    std::string string_bytes = string_stream.str();
+    std::memcpy(&int_bytes[16], &huge, sizeof(huge));
+    std::memcpy(&string_bytes[24], &huge, sizeof(huge));
+
+    std::stringstream bad_int(int_bytes);
+    std::stringstream bad_string(string_bytes);
+    s21::Vector<int> s21_res_int{7};
+    s21::Vector<std::string> s21_res_string;
+    EXPECT_THROW(s21_res_int.load(bad_int), std::runtime_error);
+    EXPECT_THROW(s21_res_string.load(bad_string), std::runtime_error);
+    EXPECT_EQ(s21_res_int.size(), 1U);
+
+    int_stream.seekg(0);
+    s21_res_int.load(int_stream);
+    EXPECT_EQ(s21_res_int.size(), 100000U);
+    EXPECT_EQ(s21_res_int.capacity(), 100000U);
+}
+
+TEST(Vector_emplace_back, case1)
+{
+    s21::Vector<std::string> s21_vec_string{"a"};
+    std::string moved = "moved";
+    s21_vec_string.emplace_back(3, 'x');
+    s21_vec_string.push_back(std::move(moved));
+    for (int i = 0; i < 10; ++i)
+    {
+        s21_vec_string.emplace_back(s21_vec_string[0]);
+    }
+
+    EXPECT_EQ(s21_vec_string.size(), 13U);
+    EXPECT_EQ(s21_vec_string[1], "xxx");
+    EXPECT_EQ(s21_vec_string[2], "moved");
+    EXPECT_EQ(s21_vec_string.emplace_back("last"), "last");
+    EXPECT_EQ(s21_vec_string[12], "a");
+}
+
+TEST(Vector_bounds_check, case1)
+{
+    s21::Vector<int> s21_vec_int{1, 4, 8, 9};
+
+    EXPECT_NO_THROW(s21::BoundsCheck<S21_BOUNDS_UNCHECKED>::check(5, 4));
+    EXPECT_THROW(s21::BoundsCheck<S21_BOUNDS_THROW>::check(4, 4), std::out_of_range);
+    EXPECT_NO_THROW(s21::BoundsCheck<S21_BOUNDS_THROW>::check(3, 4));
+    EXPECT_DEATH(s21::BoundsCheck<S21_BOUNDS_ABORT>::check(4, 4), "out of range");
+    EXPECT_THROW(s21_vec_int.at(4), std::out_of_range);
+#if S21_BOUNDS_CHECK == S21_BOUNDS_THROW
+    EXPECT_THROW(s21_vec_int[4], std::out_of_range);
+#endif
+    EXPECT_EQ(s21_vec_int[3], 9);
+}
+
 TEST(Vector_push_back, case1)
 {
     s21::Vector<int> s21_vec_int{1, 4, 8, 9};
@@ -636,4 +1030,13 @@ TEST(vec, case99)
 
     EXPECT_EQ(m, l);
     EXPECT_EQ(vec[0], vec.at(0));
-}
\ No newline at end of file
+}
+TEST(Vector_alloc_stats, disabled)
+{
+    // без S21_ALLOC_STATS учёт не занимает места в векторе
+    static_assert(sizeof(s21::Vector<int>) == 2 * sizeof(size_t) + sizeof(int *));
+    s21::Vector<int> vec{1, 2, 3};
+    vec.reserve(100);
+    EXPECT_EQ(vec.alloc_stats().allocations, 0U);
+    EXPECT_EQ(s21::alloc_stats::global().bytes_live, 0U);
+}
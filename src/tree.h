@@ -1,13 +1,114 @@
 #ifndef S21_TREE2_H
 #define S21_TREE2_H
 
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "s21_alloc_stats.h"
+#include "s21_trace.h"
+
 namespace s21
 {
-  template <typename K, typename V = K>
-  class Tree
+  // Форма дерева: глубина корня 0, высота - число уровней.
+  // imbalance - высота, делённая на высоту идеально сбалансированного
+  // дерева из того же числа узлов (1.0 - лучше некуда).
+  struct TreeStats
+  {
+    size_t nodes = 0;
+    size_t height = 0;
+    size_t max_depth = 0;
+    double average_depth = 0.0;
+    // depth_histogram[d] - число узлов на глубине d
+    std::vector<size_t> depth_histogram;
+    // память самих узлов и хранимых в них пар ключ-значение;
+    // динамическая память внутри ключей не учитывается
+    size_t node_bytes = 0;
+    size_t payload_bytes = 0;
+    double imbalance = 1.0;
+  };
+
+  // Счётчики кэша поиска (Tree::set_lookup_cache)
+  struct LookupCacheStats
+  {
+    size_t hits = 0;
+    size_t misses = 0;
+  };
+
+  // Перестройка дерева при поиске:
+  //   kStatic    - дерево не меняется (по умолчанию),
+  //   kSplay     - найденный (или последний пройденный) узел
+  //                поднимается в корень splay-поворотами,
+  //   kMoveToRoot - найденный узел поднимается в корень одиночными
+  //                поворотами.
+  // Часто запрашиваемые ключи оказываются у корня. Поиск в
+  // самонастраивающемся режиме меняет форму дерева, поэтому даже
+  // константные операции нельзя вызывать из разных потоков.
+  enum class AccessMode
+  {
+    kStatic,
+    kSplay,
+    kMoveToRoot
+  };
+
+  // Префикс ключа в узле Tree: make(key) - первые байты ключа как
+  // число, причём из prefix(a) < prefix(b) следует a < b. Спуск
+  // сравнивает сначала префиксы, хранящиеся в самих узлах, и
+  // обращается к ключу только при равенстве префиксов. Для
+  // std::string это экономит переход в буфер строки на каждом
+  // уровне. Другие типы ключей включают префикс специализацией.
+  struct NoKeyPrefix
+  {
+    static constexpr bool enabled = false;
+  };
+
+  template <typename K>
+  struct KeyPrefix : NoKeyPrefix
+  {
+  };
+
+  // первые 8 байт big-endian, короткая строка дополнена нулями
+  template <>
+  struct KeyPrefix<std::string>
+  {
+    static constexpr bool enabled = true;
+
+    static uint64_t make(const std::string &key)
+    {
+      uint64_t prefix = 0;
+      size_t n = key.size() < 8 ? key.size() : 8;
+      for (size_t i = 0; i < n; ++i)
+      {
+        prefix |= uint64_t(static_cast<unsigned char>(key[i])) << (56 - 8 * i);
+      }
+      return prefix;
+    }
+  };
+
+  template <bool Enabled>
+  struct KeyPrefixSlot
+  {
+    uint64_t key_prefix_ = 0;
+  };
+
+  template <>
+  struct KeyPrefixSlot<false>
+  {
+  };
+
+  // Tracer - политика трассировки операций (см. s21_trace.h),
+  // Prefix - префикс ключа в узле (KeyPrefix, NoKeyPrefix)
+  template <typename K, typename V = K, typename Tracer = trace::NoTrace,
+            typename Prefix = KeyPrefix<K>>
+  class Tree : private alloc_stats::Tracker<>, private Tracer
   {
   public:
     using key_type = K;
@@ -41,34 +142,171 @@ namespace s21
 
     void clear() noexcept;
     void swap(Tree &other);
-    void merge(Tree<K, V> &other);
+    void merge(Tree<K, V, Tracer, Prefix> &other);
     bool contains(const key_type &key) const noexcept;
 
+    // счётчики выделений узлов (нули при S21_ALLOC_STATS=0)
+    using alloc_stats::Tracker<>::alloc_stats;
+
+    // повороты вне kStatic не обновляют оценку высоты, поэтому при
+    // возврате в kStatic она пересчитывается обходом
+    void set_access_mode(AccessMode mode) noexcept
+    {
+      if (track_height_ && mode == AccessMode::kStatic && access_mode_ != mode)
+      {
+        height_bound_ = height_();
+      }
+      access_mode_ = mode;
+    }
+
+    // Кэш последних найденных узлов перед спуском по дереву: slots
+    // ячеек (округляется до степени двойки), ways = 1 - прямое
+    // отображение, 2 - двухвходовый ассоциативный с вытеснением
+    // давнего. Хранятся только успешные поиски, удалённый узел
+    // вычёркивается. slots = 0 выключает кэш. Поиск обновляет кэш,
+    // поэтому константные операции нельзя вызывать из разных потоков.
+    void set_lookup_cache(size_type slots, size_type ways = 1);
+    LookupCacheStats lookup_cache_stats() const;
+    AccessMode access_mode() const noexcept { return access_mode_; }
+
+    // накопленные трассировщиком данные
+    const Tracer &tracer() const { return *this; }
+
+    // полный обход за O(n) без рекурсии
+    TreeStats stats() const;
+    // Инкрементальный учёт высоты: вставка обновляет верхнюю оценку
+    // за O(1). Удаление высоту не увеличивает, поэтому оценка остаётся
+    // верной и точна, пока не было удалений; track_height(true)
+    // пересчитывает её обходом. stats() и height_bound() ничего не
+    // пишут и безопасны для одновременного чтения.
+    void track_height(bool enabled);
+    // с track_height - O(1) оценка сверху, иначе точная высота обходом;
+    // повороты могут увеличить высоту, поэтому вне kStatic всегда обход
+    size_type height_bound() const;
+
   protected:
-    struct Node
+    struct Node : KeyPrefixSlot<Prefix::enabled>
     {
       value_type data_ = value_type{};
       Node *parent_ = nullptr;
       Node *left_ = nullptr;
       Node *right_ = nullptr;
 
-      Node(const value_type &elem) : data_(elem) {}
+      Node(const value_type &elem) : data_(elem) { init_prefix_(); }
+      Node(value_type &&elem) : data_(std::move(elem)) { init_prefix_(); }
       ~Node() = default;
+
+      void init_prefix_()
+      {
+        if constexpr (Prefix::enabled)
+        {
+          this->key_prefix_ = Prefix::make(data_.first);
+        }
+      }
+    };
+
+    static uint64_t key_prefix_(const key_type &key)
+    {
+      if constexpr (Prefix::enabled)
+      {
+        return Prefix::make(key);
+      }
+      else
+      {
+        (void)key;
+        return 0;
+      }
+    }
+    // порядок вставки: равные ключи уходят влево
+    static bool goes_left_(const key_type &key, uint64_t prefix, const Node *node)
+    {
+      if constexpr (Prefix::enabled)
+      {
+        if (prefix != node->key_prefix_)
+        {
+          return prefix < node->key_prefix_;
+        }
+      }
+      (void)prefix;
+      return key <= node->data_.first;
+    }
+
+    // поворот x вокруг родителя, x поднимается на уровень
+    void rotate_up_(Node *x) const noexcept;
+    // поднять x по правилам access_mode_, возвращает число поворотов
+    size_type adjust_(Node *x, bool found) const noexcept;
+
+    template <typename... Args>
+    Node *make_node_(Args &&...args);
+    void drop_node_(Node *node) noexcept;
+
+    struct LookupCache
+    {
+      // ways подряд идущих ячеек на набор
+      std::vector<Node *> slots;
+      // для двух входов - какой вход набора использован последним
+      std::vector<unsigned char> recent;
+      size_type ways;
+      unsigned shift;
+      LookupCacheStats stats;
+
+      size_type set_of(const key_type &key) const
+      {
+        if constexpr (kHashable)
+        {
+          uint64_t h = static_cast<uint64_t>(std::hash<key_type>{}(key));
+          return shift == 64 ? 0 : (h * 0x9E3779B97F4A7C15ULL) >> shift;
+        }
+        else
+        {
+          (void)key;
+          return 0;
+        }
+      }
+    };
+
+    // кэш поиска нужен std::hash ключа
+    template <typename Key, typename = void>
+    struct Hashable : std::false_type
+    {
+    };
+    template <typename Key>
+    struct Hashable<Key, std::void_t<decltype(std::hash<Key>{}(std::declval<const Key &>()))>>
+        : std::true_type
+    {
     };
+    static constexpr bool kHashable = Hashable<key_type>::value;
 
-    void insert_(Node *&root, const value_type &kv_pair);
+    Node *cache_find_(const key_type &key) const noexcept;
+    void cache_store_(Node *node) const noexcept;
+    void cache_forget_(Node *node) noexcept;
+
+    // возвращает глубину нового узла
+    size_type insert_(Node *&root, const value_type &kv_pair);
+    void note_depth_(size_type depth)
+    {
+      if (track_height_ && depth >= height_bound_)
+      {
+        height_bound_ = depth + 1;
+      }
+    }
+    // точная высота обходом по ссылкам на родителя, без выделений
+    size_type height_() const noexcept;
+    template <typename It>
+    Node *build_sorted_(It first, size_type lo, size_type hi, Node *parent);
     // void contains(key_type &key) const noexcept;
     void clear_node(Node *node);
 
     void remove_node_with_no_children(Node *cur);
     void remove_node_with_one_child(Node *cur);
-    void remove_node_with_two_children(Node *cur);
+    // возвращает число узлов, пройденных в поиске преемника
+    size_type remove_node_with_two_children(Node *cur);
 
     class Iterator
     {
     protected:
       Node *current_;
-      const Tree<K, V> *tree_;
+      const Tree<K, V, Tracer, Prefix> *tree_;
 
     private:
       void move_(bool to_right);
@@ -79,7 +317,7 @@ namespace s21
       Node *min_();
 
     public:
-      Iterator(Node *first, const Tree<key_type, mapped_type> &second) noexcept
+      Iterator(Node *first, const Tree &second) noexcept
           : current_(first), tree_(&second) {}
       Iterator(const Iterator &other)
       {
@@ -134,21 +372,31 @@ namespace s21
     iterator find_pos(const key_type &key) const noexcept;
 
     template <class... Args>
-    std::vector<std::pair<typename Tree<key_type, mapped_type>::Iterator, bool>>
+    std::vector<std::pair<typename Tree::Iterator, bool>>
     insert_many(Args &&...args);
 
   public:
     std::pair<iterator, bool> insert(const value_type &kv_pair);
     std::pair<iterator, bool> insert_or_assign(const value_type &kv_pair);
 
+    // заменить содержимое элементами [first, last), отсортированными
+    // строго по возрастанию ключа; дерево строится сбалансированным за O(n)
+    template <typename It>
+    void assign_sorted(It first, It last);
+
   private:
-    Node *root_ = nullptr;
+    // mutable: самонастраивающийся поиск поворачивает дерево
+    mutable Node *root_ = nullptr;
     size_type size_ = 0;
     size_type max_size_;
+    size_type height_bound_ = 0;
+    bool track_height_ = false;
+    AccessMode access_mode_ = AccessMode::kStatic;
+    std::unique_ptr<LookupCache> cache_;
   };
 
-  template <typename K, typename V>
-  Tree<K, V>::Tree(const std::initializer_list<value_type> &items)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  Tree<K, V, Tracer, Prefix>::Tree(const std::initializer_list<value_type> &items)
   {
     for (auto &item : items)
     {
@@ -156,39 +404,45 @@ namespace s21
     }
   }
 
-  template <typename K, typename V>
-  Tree<K, V> &Tree<K, V>::operator=(const Tree &other) noexcept
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  Tree<K, V, Tracer, Prefix> &Tree<K, V, Tracer, Prefix>::operator=(const Tree &other) noexcept
   {
     if (this != &other)
     {
+      // в kSplay упорядоченная вставка стоит O(1) на элемент
+      access_mode_ = other.access_mode_;
       for (iterator it = other.begin(); it != other.end(); ++it)
       {
         this->insert(*it);
       }
+      // копия получает пустой кэш той же формы
+      if (other.cache_)
+      {
+        set_lookup_cache(other.cache_->slots.size(), other.cache_->ways);
+      }
     }
     return *this;
   }
 
-  template <typename K, typename V>
-  Tree<K, V> &Tree<K, V>::operator=(Tree &&other) noexcept
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  Tree<K, V, Tracer, Prefix> &Tree<K, V, Tracer, Prefix>::operator=(Tree &&other) noexcept
   {
     if (this != &other)
     {
-      root_ = other.root_;
-      this->size_ = other.size_;
-      other.clear();
+      clear();
+      swap(other);
     }
     return *this;
   }
 
-  template <typename K, typename V>
-  typename Tree<K, V>::size_type Tree<K, V>::size() const noexcept
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::size_type Tree<K, V, Tracer, Prefix>::size() const noexcept
   {
     return size_;
   }
 
-  template <typename K, typename V>
-  void Tree<K, V>::clear() noexcept
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::clear() noexcept
   {
     if (root_ != nullptr)
     {
@@ -196,18 +450,24 @@ namespace s21
     }
     root_ = nullptr;
     size_ = 0;
+    height_bound_ = 0;
   }
 
-  template <typename K, typename V>
-  inline void Tree<K, V>::swap(Tree &other)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline void Tree<K, V, Tracer, Prefix>::swap(Tree &other)
   {
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
     std::swap(max_size_, other.max_size_);
+    std::swap(height_bound_, other.height_bound_);
+    std::swap(track_height_, other.track_height_);
+    std::swap(access_mode_, other.access_mode_);
+    cache_.swap(other.cache_);
+    swap_alloc_stats_(other);
   }
 
-  template <typename K, typename V>
-  inline void Tree<K, V>::remove_node_with_no_children(Node *cur)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline void Tree<K, V, Tracer, Prefix>::remove_node_with_no_children(Node *cur)
   {
     if (cur->parent_ == nullptr)
     {
@@ -224,12 +484,12 @@ namespace s21
         cur->parent_->right_ = nullptr;
       }
     }
-    delete cur;
+    drop_node_(cur);
     size_--;
   }
 
-  template <typename K, typename V>
-  inline void Tree<K, V>::remove_node_with_one_child(Node *cur)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline void Tree<K, V, Tracer, Prefix>::remove_node_with_one_child(Node *cur)
   {
     Node *child = (cur->left_ != nullptr) ? cur->left_ : cur->right_;
 
@@ -249,18 +509,21 @@ namespace s21
       }
     }
     child->parent_ = cur->parent_;
-    delete cur;
+    drop_node_(cur);
     size_--;
   }
 
-  template <typename K, typename V>
-  inline void Tree<K, V>::remove_node_with_two_children(Node *cur)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::size_type
+  Tree<K, V, Tracer, Prefix>::remove_node_with_two_children(Node *cur)
   {
     Node *successor = cur->right_;
+    size_type visited = 1;
 
     while (successor->left_ != nullptr)
     {
       successor = successor->left_;
+      ++visited;
     }
 
     if (successor != cur->right_)
@@ -295,18 +558,21 @@ namespace s21
       cur->parent_->right_ = successor;
     }
 
-    delete cur;
+    drop_node_(cur);
     size_--;
+    return visited;
   }
 
-  template <typename K, typename V>
-  inline void Tree<K, V>::erase(iterator pos)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline void Tree<K, V, Tracer, Prefix>::erase(iterator pos)
   {
     Node *cur = pos.Get();
     if (cur == nullptr)
     {
       return;
     }
+    const bool traced = this->sample(trace::Op::kErase);
+    size_type visited = 1;
     bool cur_left_is_null = (cur->left_ == nullptr);
     bool cur_right_is_null = (cur->right_ == nullptr);
 
@@ -320,18 +586,22 @@ namespace s21
     }
     else
     {
-      remove_node_with_two_children(cur);
+      visited += remove_node_with_two_children(cur);
+    }
+    if (traced)
+    {
+      this->record(trace::Op::kErase, {0, visited, 0});
     }
   }
 
-  template <typename K, typename V>
-  typename Tree<K, V>::size_type Tree<K, V>::max_size() const noexcept
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::size_type Tree<K, V, Tracer, Prefix>::max_size() const noexcept
   {
-    return std::numeric_limits<size_t>::max() / sizeof(Tree<K, V>) / 6;
+    return std::numeric_limits<size_t>::max() / sizeof(Tree<K, V, Tracer, Prefix>) / 6;
   }
 
-  template <typename K, typename V>
-  inline V &Tree<K, V>::at(const key_type &key)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline V &Tree<K, V, Tracer, Prefix>::at(const key_type &key)
   {
     if (root_ == nullptr)
     {
@@ -345,8 +615,8 @@ namespace s21
     throw std::out_of_range("Key not found");
   }
 
-  template <typename K, typename V>
-  inline V &Tree<K, V>::operator[](const key_type &key)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline V &Tree<K, V, Tracer, Prefix>::operator[](const key_type &key)
   {
     if (!contains(key))
     {
@@ -356,8 +626,8 @@ namespace s21
     return at(key);
   }
 
-  template <typename K, typename V>
-  void Tree<K, V>::merge(Tree<K, V> &other)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::merge(Tree<K, V, Tracer, Prefix> &other)
   {
     if (other.root_ == nullptr || root_ == other.root_)
       return;
@@ -377,16 +647,21 @@ namespace s21
     }
   }
 
-  template <typename K, typename V>
-  void Tree<K, V>::insert_(Node *&node_, const Tree<K, V>::value_type &kv_pair)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::size_type
+  Tree<K, V, Tracer, Prefix>::insert_(Node *&node_, const Tree<K, V, Tracer, Prefix>::value_type &kv_pair)
   {
+    const bool traced = this->sample(trace::Op::kInsert);
+    const uint64_t prefix = key_prefix_(kv_pair.first);
     Node *current = node_;
     Node *parent = nullptr;
+    size_type depth = 0;
 
     while (current != nullptr)
     {
       parent = current;
-      if (kv_pair.first <= current->data_.first)
+      ++depth;
+      if (goes_left_(kv_pair.first, prefix, current))
       {
         current = current->left_;
       }
@@ -396,14 +671,14 @@ namespace s21
       }
     }
 
-    Node *new_node = new Node(kv_pair);
+    Node *new_node = make_node_(kv_pair);
     new_node->parent_ = parent;
 
     if (parent == nullptr)
     {
       node_ = new_node;
     }
-    else if (kv_pair.first <= parent->data_.first)
+    else if (goes_left_(kv_pair.first, prefix, parent))
     {
       parent->left_ = new_node;
     }
@@ -411,11 +686,17 @@ namespace s21
     {
       parent->right_ = new_node;
     }
+    if (traced)
+    {
+      // одно сравнение на уровень и ещё одно у родителя
+      this->record(trace::Op::kInsert, {depth + (parent != nullptr), depth, 0});
+    }
+    return depth;
   }
 
-  template <typename K, typename V>
-  std::pair<typename Tree<K, V>::iterator, bool> Tree<K, V>::insert(
-      const Tree<K, V>::value_type &kv_pair)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  std::pair<typename Tree<K, V, Tracer, Prefix>::iterator, bool> Tree<K, V, Tracer, Prefix>::insert(
+      const Tree<K, V, Tracer, Prefix>::value_type &kv_pair)
   {
     const K &key = kv_pair.first;
 
@@ -425,19 +706,20 @@ namespace s21
     }
     if (root_ == nullptr)
     {
-      root_ = new Node(kv_pair);
+      root_ = make_node_(kv_pair);
+      note_depth_(0);
     }
     else
     {
-      insert_(root_, kv_pair);
+      note_depth_(insert_(root_, kv_pair));
     }
     size_++;
     return {find_pos(key), true};
   }
 
-  template <typename K, typename V>
-  std::pair<typename Tree<K, V>::iterator, bool> Tree<K, V>::insert_or_assign(
-      const Tree<K, V>::value_type &kv_pair)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  std::pair<typename Tree<K, V, Tracer, Prefix>::iterator, bool> Tree<K, V, Tracer, Prefix>::insert_or_assign(
+      const Tree<K, V, Tracer, Prefix>::value_type &kv_pair)
   {
     const K &key = kv_pair.first;
     Iterator it = find_pos(key);
@@ -449,25 +731,59 @@ namespace s21
 
     if (root_ == nullptr)
     {
-      root_ = new Node(kv_pair);
+      root_ = make_node_(kv_pair);
+      note_depth_(0);
     }
     else
     {
-      insert_(root_, kv_pair);
+      note_depth_(insert_(root_, kv_pair));
     }
 
     size_++;
     return {find_pos(key), true};
   }
 
-  template <typename K, typename V>
-  inline bool Tree<K, V>::contains(const key_type &key) const noexcept
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline bool Tree<K, V, Tracer, Prefix>::contains(const key_type &key) const noexcept
   {
     return find_pos(key) != end();
   }
 
-  template <typename K, typename V>
-  void Tree<K, V>::clear_node(Node *node)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  template <typename... Args>
+  typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::make_node_(Args &&...args)
+  {
+    const bool traced = this->sample(trace::Op::kAllocate);
+    std::chrono::steady_clock::time_point start;
+    if (traced)
+    {
+      start = std::chrono::steady_clock::now();
+    }
+    Node *node = new Node(std::forward<Args>(args)...);
+    if (traced)
+    {
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start);
+      this->record(trace::Op::kAllocate,
+                   {0, 0, 0, static_cast<uint64_t>(elapsed.count())});
+    }
+    on_allocate_(alloc_stats::Source::kTree, sizeof(Node));
+    return node;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::drop_node_(Node *node) noexcept
+  {
+    if (cache_)
+    {
+      cache_forget_(node);
+    }
+    on_free_(alloc_stats::Source::kTree, sizeof(Node));
+    delete node;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::clear_node(Node *node)
   {
     if (node->left_ != nullptr)
     {
@@ -477,21 +793,50 @@ namespace s21
     {
       clear_node(node->right_);
     }
-    delete node;
+    drop_node_(node);
   }
 
-  template <typename K, typename V>
-  typename Tree<K, V>::iterator Tree<K, V>::find_pos(
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::iterator Tree<K, V, Tracer, Prefix>::find_pos(
       const key_type &key) const noexcept
   {
+    const bool traced = this->sample(trace::Op::kFind);
+    trace::OpTrace op;
+    if (cache_)
+    {
+      if (Node *hit = cache_find_(key))
+      {
+        if (traced)
+        {
+          this->record(trace::Op::kFind, {1, 0, 0, 0});
+        }
+        return iterator(hit, *this);
+      }
+    }
+    const uint64_t prefix = key_prefix_(key);
     Node *current = root_;
+    Node *last = nullptr;
     while (current != nullptr)
     {
+      ++op.visited;
+      ++op.comparisons;
+      if constexpr (Prefix::enabled)
+      {
+        // разные префиксы решают без обращения к ключу
+        if (prefix != current->key_prefix_)
+        {
+          last = current;
+          current = prefix < current->key_prefix_ ? current->left_ : current->right_;
+          continue;
+        }
+      }
       if (key == current->data_.first)
       {
-        return iterator(current, *this);
+        break;
       }
-      else if (key < current->data_.first)
+      ++op.comparisons;
+      last = current;
+      if (key < current->data_.first)
       {
         current = current->left_;
       }
@@ -500,11 +845,23 @@ namespace s21
         current = current->right_;
       }
     }
-    return end();
+    if (access_mode_ != AccessMode::kStatic)
+    {
+      op.rotations = adjust_(current != nullptr ? current : last, current != nullptr);
+    }
+    if (cache_ && current != nullptr)
+    {
+      cache_store_(current);
+    }
+    if (traced)
+    {
+      this->record(trace::Op::kFind, op);
+    }
+    return current != nullptr ? iterator(current, *this) : end();
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::iterator Tree<K, V>::begin() const
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::iterator Tree<K, V, Tracer, Prefix>::begin() const
   {
     if (this->root_ == nullptr)
     {
@@ -518,30 +875,30 @@ namespace s21
     return iterator(tmp_node, *this);
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::iterator Tree<K, V>::end() const
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::iterator Tree<K, V, Tracer, Prefix>::end() const
   {
     return iterator(nullptr, *this);
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::Iterator Tree<K, V>::Iterator::operator++(int)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::Iterator Tree<K, V, Tracer, Prefix>::Iterator::operator++(int)
   {
     Iterator tmp(*this);
     move_(true);
     return tmp;
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::Iterator Tree<K, V>::Iterator::operator--(int)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::Iterator Tree<K, V, Tracer, Prefix>::Iterator::operator--(int)
   {
     Iterator tmp(*this);
     move_(false);
     return tmp;
   }
 
-  template <typename K, typename V>
-  inline void Tree<K, V>::Iterator::move_(bool to_right)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline void Tree<K, V, Tracer, Prefix>::Iterator::move_(bool to_right)
   {
     if (current_ == nullptr)
     {
@@ -575,8 +932,8 @@ namespace s21
     }
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::Node *Tree<K, V>::Iterator::find_parent_(
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::Iterator::find_parent_(
       Node *node)
   {
     if (node == nullptr)
@@ -590,8 +947,8 @@ namespace s21
     return node;
   }
 
-  template <typename K, typename V>
-  typename Tree<K, V>::Node *Tree<K, V>::Iterator::find_leftmost_(Node *node)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::Iterator::find_leftmost_(Node *node)
   {
     while (node->left_ != nullptr)
     {
@@ -600,8 +957,8 @@ namespace s21
     return node;
   }
 
-  template <typename K, typename V>
-  typename Tree<K, V>::Node *Tree<K, V>::Iterator::find_rightmost_(Node *node)
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::Iterator::find_rightmost_(Node *node)
   {
     while (node->right_ != nullptr)
     {
@@ -610,32 +967,309 @@ namespace s21
     return node;
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::Node *Tree<K, V>::Iterator::max_()
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::Iterator::max_()
   {
     Node *tmp_max = find_parent_(current_);
     tmp_max = find_rightmost_(tmp_max);
     return tmp_max;
   }
 
-  template <typename K, typename V>
-  inline typename Tree<K, V>::Node *Tree<K, V>::Iterator::min_()
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  inline typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::Iterator::min_()
   {
     Node *tmp_min = find_parent_(current_);
     tmp_min = find_leftmost_(tmp_min);
     return tmp_min;
   }
 
-  template <typename K, typename V>
+  template <typename K, typename V, typename Tracer, typename Prefix>
   template <typename... Args>
-  std::vector<std::pair<typename Tree<K, V>::iterator, bool>>
-  Tree<K, V>::insert_many(Args &&...args)
+  std::vector<std::pair<typename Tree<K, V, Tracer, Prefix>::iterator, bool>>
+  Tree<K, V, Tracer, Prefix>::insert_many(Args &&...args)
   {
     std::vector<std::pair<iterator, bool>> result;
     (result.push_back(insert(std::forward<Args>(args))), ...);
     return result;
   }
 
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  template <typename It>
+  void Tree<K, V, Tracer, Prefix>::assign_sorted(It first, It last)
+  {
+    clear();
+    size_type n = static_cast<size_type>(last - first);
+    root_ = build_sorted_(first, 0, n, nullptr);
+    size_ = n;
+    // середина делит отрезок пополам: высота floor(log2 n) + 1
+    for (size_type rest = n; rest && track_height_; rest /= 2)
+    {
+      ++height_bound_;
+    }
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  template <typename It>
+  typename Tree<K, V, Tracer, Prefix>::Node *Tree<K, V, Tracer, Prefix>::build_sorted_(It first, size_type lo,
+                                                       size_type hi,
+                                                       Node *parent)
+  {
+    if (lo >= hi)
+    {
+      return nullptr;
+    }
+    size_type mid = lo + (hi - lo) / 2;
+    Node *node = make_node_(value_type(std::move(first[mid])));
+    node->parent_ = parent;
+    node->left_ = build_sorted_(first, lo, mid, node);
+    node->right_ = build_sorted_(first, mid + 1, hi, node);
+    return node;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::rotate_up_(Node *x) const noexcept
+  {
+    Node *parent = x->parent_;
+    Node *grand = parent->parent_;
+    if (parent->left_ == x)
+    {
+      parent->left_ = x->right_;
+      if (x->right_ != nullptr)
+      {
+        x->right_->parent_ = parent;
+      }
+      x->right_ = parent;
+    }
+    else
+    {
+      parent->right_ = x->left_;
+      if (x->left_ != nullptr)
+      {
+        x->left_->parent_ = parent;
+      }
+      x->left_ = parent;
+    }
+    parent->parent_ = x;
+    x->parent_ = grand;
+    if (grand == nullptr)
+    {
+      root_ = x;
+    }
+    else if (grand->left_ == parent)
+    {
+      grand->left_ = x;
+    }
+    else
+    {
+      grand->right_ = x;
+    }
+  }
+
+  // промах поднимает последний пройденный узел только в kSplay:
+  // без этого у splay-дерева нет амортизированной оценки
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::size_type
+  Tree<K, V, Tracer, Prefix>::adjust_(Node *x, bool found) const noexcept
+  {
+    size_type rotations = 0;
+    if (x == nullptr || (!found && access_mode_ != AccessMode::kSplay))
+    {
+      return rotations;
+    }
+    while (x->parent_ != nullptr)
+    {
+      Node *parent = x->parent_;
+      Node *grand = parent->parent_;
+      if (access_mode_ == AccessMode::kSplay && grand != nullptr)
+      {
+        // zig-zig: сначала родитель, zig-zag: дважды сам узел
+        rotate_up_((grand->left_ == parent) == (parent->left_ == x) ? parent : x);
+        ++rotations;
+      }
+      rotate_up_(x);
+      ++rotations;
+    }
+    return rotations;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::set_lookup_cache(size_type slots, size_type ways)
+  {
+    if (ways != 1 && ways != 2)
+    {
+      throw std::invalid_argument("Lookup cache supports 1 or 2 ways");
+    }
+    if (!kHashable && slots != 0)
+    {
+      throw std::invalid_argument("Lookup cache needs std::hash of the key");
+    }
+    if (slots == 0)
+    {
+      cache_.reset();
+      return;
+    }
+    size_type sets = 1;
+    unsigned shift = 64;
+    while (sets * ways < slots)
+    {
+      sets *= 2;
+      --shift;
+    }
+    auto cache = std::make_unique<LookupCache>();
+    cache->slots.assign(sets * ways, nullptr);
+    cache->recent.assign(ways == 2 ? sets : 0, 0);
+    cache->ways = ways;
+    cache->shift = shift;
+    cache_ = std::move(cache);
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  LookupCacheStats Tree<K, V, Tracer, Prefix>::lookup_cache_stats() const
+  {
+    return cache_ ? cache_->stats : LookupCacheStats{};
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::Node *
+  Tree<K, V, Tracer, Prefix>::cache_find_(const key_type &key) const noexcept
+  {
+    LookupCache &cache = *cache_;
+    size_type set = cache.set_of(key);
+    for (size_type way = 0; way < cache.ways; ++way)
+    {
+      Node *node = cache.slots[set * cache.ways + way];
+      if (node != nullptr && node->data_.first == key)
+      {
+        if (cache.ways == 2)
+        {
+          cache.recent[set] = static_cast<unsigned char>(way);
+        }
+        ++cache.stats.hits;
+        return node;
+      }
+    }
+    ++cache.stats.misses;
+    return nullptr;
+  }
+
+  // занимает свободный вход или вытесняет давно использованный
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::cache_store_(Node *node) const noexcept
+  {
+    LookupCache &cache = *cache_;
+    size_type set = cache.set_of(node->data_.first);
+    size_type way = 0;
+    if (cache.ways == 2)
+    {
+      Node *first = cache.slots[set * 2];
+      way = first == nullptr ? 0 : cache.recent[set] ^ 1;
+      cache.recent[set] = static_cast<unsigned char>(way);
+    }
+    cache.slots[set * cache.ways + way] = node;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::cache_forget_(Node *node) noexcept
+  {
+    LookupCache &cache = *cache_;
+    size_type set = cache.set_of(node->data_.first);
+    for (size_type way = 0; way < cache.ways; ++way)
+    {
+      if (cache.slots[set * cache.ways + way] == node)
+      {
+        cache.slots[set * cache.ways + way] = nullptr;
+      }
+    }
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  TreeStats Tree<K, V, Tracer, Prefix>::stats() const
+  {
+    TreeStats result;
+    result.nodes = size_;
+    result.node_bytes = size_ * sizeof(Node);
+    result.payload_bytes = size_ * sizeof(value_type);
+    if (root_ == nullptr)
+    {
+      return result;
+    }
+
+    size_type depth_sum = 0;
+    std::vector<std::pair<const Node *, size_type>> pending{{root_, 0}};
+    while (!pending.empty())
+    {
+      auto [node, depth] = pending.back();
+      pending.pop_back();
+      if (depth >= result.depth_histogram.size())
+      {
+        result.depth_histogram.resize(depth + 1);
+      }
+      ++result.depth_histogram[depth];
+      depth_sum += depth;
+      if (node->left_ != nullptr)
+      {
+        pending.emplace_back(node->left_, depth + 1);
+      }
+      if (node->right_ != nullptr)
+      {
+        pending.emplace_back(node->right_, depth + 1);
+      }
+    }
+
+    result.height = result.depth_histogram.size();
+    result.max_depth = result.height - 1;
+    result.average_depth = static_cast<double>(depth_sum) / size_;
+    double optimal = std::ceil(std::log2(static_cast<double>(size_) + 1));
+    result.imbalance = result.height / optimal;
+    return result;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::size_type Tree<K, V, Tracer, Prefix>::height_() const noexcept
+  {
+    size_type height = 0;
+    size_type depth = 1;
+    const Node *node = root_;
+    while (node != nullptr)
+    {
+      height = depth > height ? depth : height;
+      if (node->left_ != nullptr || node->right_ != nullptr)
+      {
+        node = node->left_ != nullptr ? node->left_ : node->right_;
+        ++depth;
+        continue;
+      }
+      // поднимаемся до первого левого сына, у родителя которого есть
+      // правое поддерево
+      const Node *parent = node->parent_;
+      while (parent != nullptr && (node == parent->right_ || parent->right_ == nullptr))
+      {
+        node = parent;
+        parent = node->parent_;
+        --depth;
+      }
+      node = parent != nullptr ? parent->right_ : nullptr;
+    }
+    return height;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  void Tree<K, V, Tracer, Prefix>::track_height(bool enabled)
+  {
+    if (enabled)
+    {
+      height_bound_ = height_();
+    }
+    track_height_ = enabled;
+  }
+
+  template <typename K, typename V, typename Tracer, typename Prefix>
+  typename Tree<K, V, Tracer, Prefix>::size_type Tree<K, V, Tracer, Prefix>::height_bound() const
+  {
+    return track_height_ && access_mode_ == AccessMode::kStatic ? height_bound_
+                                                                : stats().height;
+  }
+
 } // namespace s21
 
 #endif // S21_TREE_H_
\ No newline at end of file
@@ -0,0 +1,379 @@
+#ifndef S21_BIT_VECTOR_H
+#define S21_BIT_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_config.h"
+#include "s21_vector.h"
+#include "s21_vector_simd.h"
+
+namespace s21
+{
+    // Упакованный массив бит: по 64 флага в слове uint64_t, в 8 раз
+    // меньше памяти, чем массив bool. Слова лежат в Vector<uint64_t>,
+    // поэтому большие массивы получают mmap и mremap при росте.
+    // count и побитовые операции идут пословно через simd::popcount и
+    // simd::bitwise.
+    //
+    // Инвариант: биты последнего слова за пределами size() равны нулю.
+    class BitVector
+    {
+    public:
+        using value_type = bool;
+        using size_type = size_t;
+        using word_type = uint64_t;
+
+        static constexpr size_type kWordBits = 64;
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        // ссылка на один бит
+        class reference
+        {
+        public:
+            reference(word_type *word, word_type mask) : word_(word), mask_(mask) {}
+            reference(const reference &) = default;
+
+            operator bool() const { return (*word_ & mask_) != 0; }
+            bool operator~() const { return !bool(*this); }
+            reference &operator=(bool value)
+            {
+                *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+                return *this;
+            }
+            reference &operator=(const reference &other) { return *this = bool(other); }
+            reference &flip()
+            {
+                *word_ ^= mask_;
+                return *this;
+            }
+
+        private:
+            word_type *word_;
+            word_type mask_;
+        };
+
+        BitVector() = default;
+        explicit BitVector(size_type n, bool value = false) { resize(n, value); }
+        BitVector(std::initializer_list<bool> const &items);
+        BitVector(const BitVector &other) = default;
+        BitVector(BitVector &&other) noexcept;
+        BitVector &operator=(const BitVector &other);
+        BitVector &operator=(BitVector &&other) noexcept;
+
+        bool at(size_type pos) const;
+        reference operator[](size_type pos);
+        bool operator[](size_type pos) const;
+        bool test(size_type pos) const { return at(pos); }
+        bool front() const { return (*this)[0]; }
+        bool back() const { return (*this)[size_ - 1]; }
+
+        bool empty() const { return size_ == 0; }
+        size_type size() const { return size_; }
+        size_type capacity() const { return words_.capacity() * kWordBits; }
+        void reserve(size_type bits) { words_.reserve(words_for_(bits)); }
+        void shrink_to_fit() { words_.shrink_to_fit(); }
+        void resize(size_type count, bool value = false);
+        void clear();
+        void push_back(bool value);
+        void pop_back();
+        void swap(BitVector &other);
+
+        // все биты сразу
+        BitVector &set();
+        BitVector &reset();
+        BitVector &flip();
+        // один бит, с проверкой индекса
+        BitVector &set(size_type pos, bool value = true);
+        BitVector &reset(size_type pos) { return set(pos, false); }
+        BitVector &flip(size_type pos);
+
+        size_type count() const { return simd::popcount(words_.data(), words_.size()); }
+        bool any() const;
+        bool none() const { return !any(); }
+        bool all() const { return count() == size_; }
+        // индекс первого единичного бита или npos
+        size_type find_first() const { return find_from_(0); }
+        // первый единичный бит после pos или npos (в том числе для
+        // pos >= size(), включая npos)
+        size_type find_next(size_type pos) const;
+
+        // размеры операндов должны совпадать, иначе std::invalid_argument
+        BitVector &operator&=(const BitVector &other);
+        BitVector &operator|=(const BitVector &other);
+        BitVector &operator^=(const BitVector &other);
+        BitVector operator~() const;
+        bool operator==(const BitVector &other) const;
+        bool operator!=(const BitVector &other) const { return !(*this == other); }
+
+        const word_type *data() const { return words_.data(); }
+        size_type word_count() const { return words_.size(); }
+
+    private:
+        static size_type words_for_(size_type bits) { return (bits + kWordBits - 1) / kWordBits; }
+        static word_type mask_(size_type pos) { return word_type(1) << (pos % kWordBits); }
+        void clear_tail_();
+        size_type find_from_(size_type pos) const;
+        void require_same_size_(const BitVector &other) const;
+        template <simd::BitOp Op>
+        BitVector &apply_(const BitVector &other);
+
+        Vector<word_type> words_;
+        size_type size_ = 0;
+    };
+
+    inline BitVector::BitVector(std::initializer_list<bool> const &items)
+    {
+        reserve(items.size());
+        for (bool item : items)
+        {
+            push_back(item);
+        }
+    }
+
+    inline BitVector::BitVector(BitVector &&other) noexcept
+        : words_(std::move(other.words_)), size_(other.size_)
+    {
+        other.size_ = 0;
+    }
+
+    inline BitVector &BitVector::operator=(const BitVector &other)
+    {
+        if (this != &other)
+        {
+            BitVector tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    inline BitVector &BitVector::operator=(BitVector &&other) noexcept
+    {
+        if (this != &other)
+        {
+            words_ = std::move(other.words_);
+            size_ = other.size_;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    inline bool BitVector::at(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return (words_.data()[pos / kWordBits] & mask_(pos)) != 0;
+    }
+
+    inline BitVector::reference BitVector::operator[](size_type pos)
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return reference(words_.data() + pos / kWordBits, mask_(pos));
+    }
+
+    inline bool BitVector::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return (words_.data()[pos / kWordBits] & mask_(pos)) != 0;
+    }
+
+    inline void BitVector::resize(size_type count, bool value)
+    {
+        if (value && count > size_ && size_ % kWordBits)
+        {
+            words_.data()[size_ / kWordBits] |= ~word_type(0) << (size_ % kWordBits);
+        }
+        words_.resize(words_for_(count), value ? ~word_type(0) : 0);
+        size_ = count;
+        clear_tail_();
+    }
+
+    inline void BitVector::clear()
+    {
+        words_.clear();
+        size_ = 0;
+    }
+
+    inline void BitVector::push_back(bool value)
+    {
+        if (size_ % kWordBits == 0)
+        {
+            words_.push_back(0);
+        }
+        if (value)
+        {
+            words_.data()[size_ / kWordBits] |= mask_(size_);
+        }
+        ++size_;
+    }
+
+    inline void BitVector::pop_back()
+    {
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Vector is empty");
+        }
+        --size_;
+        if (size_ % kWordBits == 0)
+        {
+            words_.pop_back();
+        }
+        else
+        {
+            words_.data()[size_ / kWordBits] &= ~mask_(size_);
+        }
+    }
+
+    inline void BitVector::swap(BitVector &other)
+    {
+        words_.swap(other.words_);
+        std::swap(size_, other.size_);
+    }
+
+    inline BitVector &BitVector::set()
+    {
+        std::fill(words_.begin(), words_.end(), ~word_type(0));
+        clear_tail_();
+        return *this;
+    }
+
+    inline BitVector &BitVector::reset()
+    {
+        std::fill(words_.begin(), words_.end(), word_type(0));
+        return *this;
+    }
+
+    inline BitVector &BitVector::flip()
+    {
+        for (word_type &word : words_)
+        {
+            word = ~word;
+        }
+        clear_tail_();
+        return *this;
+    }
+
+    inline BitVector &BitVector::set(size_type pos, bool value)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        (*this)[pos] = value;
+        return *this;
+    }
+
+    inline BitVector &BitVector::flip(size_type pos)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        (*this)[pos].flip();
+        return *this;
+    }
+
+    inline bool BitVector::any() const
+    {
+        const word_type *words = words_.data();
+        for (size_type i = 0; i < words_.size(); ++i)
+        {
+            if (words[i])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline BitVector::size_type BitVector::find_next(size_type pos) const
+    {
+        // pos + 1 переполняется при pos == npos
+        return pos >= size_ || pos + 1 >= size_ ? npos : find_from_(pos + 1);
+    }
+
+    inline BitVector &BitVector::operator&=(const BitVector &other)
+    {
+        return apply_<simd::BitOp::kAnd>(other);
+    }
+
+    inline BitVector &BitVector::operator|=(const BitVector &other)
+    {
+        return apply_<simd::BitOp::kOr>(other);
+    }
+
+    inline BitVector &BitVector::operator^=(const BitVector &other)
+    {
+        return apply_<simd::BitOp::kXor>(other);
+    }
+
+    inline BitVector BitVector::operator~() const
+    {
+        BitVector result(*this);
+        return result.flip();
+    }
+
+    inline bool BitVector::operator==(const BitVector &other) const
+    {
+        return size_ == other.size_ &&
+               simd::equal(words_.data(), other.words_.data(), words_.size());
+    }
+
+    inline void BitVector::clear_tail_()
+    {
+        if (size_ % kWordBits)
+        {
+            words_.data()[size_ / kWordBits] &= ~(~word_type(0) << (size_ % kWordBits));
+        }
+    }
+
+    // хвост последнего слова нулевой, поэтому проверка на size_
+    // нужна только для самого pos
+    inline BitVector::size_type BitVector::find_from_(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            return npos;
+        }
+        const word_type *words = words_.data();
+        size_type i = pos / kWordBits;
+        word_type word = words[i] & (~word_type(0) << (pos % kWordBits));
+        while (!word)
+        {
+            if (++i == words_.size())
+            {
+                return npos;
+            }
+            word = words[i];
+        }
+        return i * kWordBits + __builtin_ctzll(word);
+    }
+
+    inline void BitVector::require_same_size_(const BitVector &other) const
+    {
+        if (size_ != other.size_)
+        {
+            throw std::invalid_argument("BitVector sizes differ");
+        }
+    }
+
+    template <simd::BitOp Op>
+    BitVector &BitVector::apply_(const BitVector &other)
+    {
+        require_same_size_(other);
+        simd::bitwise<Op>(words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    inline BitVector operator&(BitVector a, const BitVector &b) { return a &= b; }
+    inline BitVector operator|(BitVector a, const BitVector &b) { return a |= b; }
+    inline BitVector operator^(BitVector a, const BitVector &b) { return a ^= b; }
+}
+
+#endif // S21_BIT_VECTOR_H
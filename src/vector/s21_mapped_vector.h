@@ -0,0 +1,366 @@
+#ifndef S21_MAPPED_VECTOR_H
+#define S21_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "../s21_config.h"
+
+namespace s21
+{
+    // Режимы отображения файла
+    enum class MapMode
+    {
+        kReadOnly,    // только чтение, страницы общие с page cache
+        kCopyOnWrite, // запись в частную копию страниц, файл не меняется
+        kReadWrite    // запись и дописывание в сам файл
+    };
+
+    // Подсказка ядру о характере доступа (madvise)
+    enum class MapAccess
+    {
+        kNormal,
+        kSequential,
+        kRandom,
+        kWillNeed
+    };
+
+    // Массив тривиально копируемых записей, отображённый из файла.
+    // Открытие стоит O(1): данные подгружаются страницами по мере
+    // обращения. API чтения совпадает с Vector; в режиме kReadWrite
+    // push_back дописывает в файл через ftruncate и перераспределение
+    // отображения.
+    //
+    // Страницы kReadOnly защищены от записи, но MappedVector<T> всё
+    // равно отдаёт T & и T *: запись через них - SIGSEGV, а не
+    // исключение. Для файлов только на чтение используйте
+    // MappedVector<const T>: он открывается лишь в kReadOnly, а
+    // записывающие методы не компилируются.
+    template <typename T>
+    class MappedVector
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "MappedVector requires a trivially copyable type");
+
+        static constexpr bool kConst = std::is_const_v<T>;
+
+    public:
+        using value_type = std::remove_const_t<T>;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        explicit MappedVector(const std::string &path,
+                              MapMode mode = MapMode::kReadOnly,
+                              MapAccess access = MapAccess::kNormal);
+        MappedVector(const MappedVector &) = delete;
+        MappedVector(MappedVector &&other) noexcept;
+        MappedVector &operator=(const MappedVector &) = delete;
+        MappedVector &operator=(MappedVector &&other) noexcept;
+        ~MappedVector();
+
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        T *data() { return arr_; }
+        const T *data() const { return arr_; }
+
+        iterator begin() { return arr_; }
+        iterator end() { return arr_ + size_; }
+        const_iterator begin() const { return arr_; }
+        const_iterator end() const { return arr_ + size_; }
+
+        bool empty() const { return size_ == 0; }
+        size_type size() const { return size_; }
+        size_type capacity() const { return capacity_; }
+        MapMode mode() const { return mode_; }
+
+        void advise(MapAccess access);
+        void reserve(size_type new_capacity);
+        void push_back(const_reference value);
+        // сбросить изменённые страницы в файл (kReadWrite)
+        void sync();
+
+    private:
+        void map_(size_type capacity);
+        void unmap_();
+        void close_();
+        void require_writable_() const;
+        // адрес отображения для системных вызовов
+        void *raw_() const { return const_cast<value_type *>(arr_); }
+
+        int fd_ = -1;
+        MapMode mode_ = MapMode::kReadOnly;
+        MapAccess access_ = MapAccess::kNormal;
+        T *arr_ = nullptr;
+        size_type size_ = 0;
+        size_type capacity_ = 0;
+    };
+
+    namespace mapped_detail
+    {
+        [[noreturn]] inline void throw_errno(const char *what)
+        {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        inline int advice(MapAccess access)
+        {
+            switch (access)
+            {
+            case MapAccess::kSequential:
+                return MADV_SEQUENTIAL;
+            case MapAccess::kRandom:
+                return MADV_RANDOM;
+            case MapAccess::kWillNeed:
+                return MADV_WILLNEED;
+            default:
+                return MADV_NORMAL;
+            }
+        }
+    }
+
+    template <typename T>
+    MappedVector<T>::MappedVector(const std::string &path, MapMode mode,
+                                  MapAccess access)
+        : mode_(mode), access_(access)
+    {
+        if (kConst && mode != MapMode::kReadOnly)
+        {
+            throw std::invalid_argument("MappedVector<const T> is read-only");
+        }
+        int flags = mode == MapMode::kReadWrite ? O_RDWR | O_CREAT : O_RDONLY;
+        fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (fd_ < 0)
+        {
+            mapped_detail::throw_errno("open");
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0)
+        {
+            int error = errno;
+            close_();
+            errno = error;
+            mapped_detail::throw_errno("fstat");
+        }
+        size_ = static_cast<size_type>(st.st_size) / sizeof(T);
+        try
+        {
+            map_(size_);
+        }
+        catch (...)
+        {
+            close_();
+            throw;
+        }
+    }
+
+    template <typename T>
+    MappedVector<T>::MappedVector(MappedVector &&other) noexcept
+        : fd_(other.fd_), mode_(other.mode_), access_(other.access_),
+          arr_(other.arr_), size_(other.size_), capacity_(other.capacity_)
+    {
+        other.fd_ = -1;
+        other.arr_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    template <typename T>
+    MappedVector<T> &MappedVector<T>::operator=(MappedVector &&other) noexcept
+    {
+        if (this != &other)
+        {
+            close_();
+            fd_ = other.fd_;
+            mode_ = other.mode_;
+            access_ = other.access_;
+            arr_ = other.arr_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.fd_ = -1;
+            other.arr_ = nullptr;
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+        return *this;
+    }
+
+    template <typename T>
+    MappedVector<T>::~MappedVector()
+    {
+        close_();
+    }
+
+    template <typename T>
+    typename MappedVector<T>::reference MappedVector<T>::at(size_type pos)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return arr_[pos];
+    }
+
+    template <typename T>
+    typename MappedVector<T>::const_reference MappedVector<T>::at(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return arr_[pos];
+    }
+
+    template <typename T>
+    typename MappedVector<T>::reference MappedVector<T>::operator[](size_type pos)
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return arr_[pos];
+    }
+
+    template <typename T>
+    typename MappedVector<T>::const_reference
+    MappedVector<T>::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, size_);
+        return arr_[pos];
+    }
+
+    template <typename T>
+    void MappedVector<T>::advise(MapAccess access)
+    {
+        access_ = access;
+        if (arr_)
+        {
+            ::madvise(raw_(), capacity_ * sizeof(T), mapped_detail::advice(access));
+        }
+    }
+
+    // файл растягивается до new_capacity записей, отображение
+    // переезжает без копирования данных
+    template <typename T>
+    void MappedVector<T>::reserve(size_type new_capacity)
+    {
+        static_assert(!kConst, "MappedVector<const T> is read-only");
+        require_writable_();
+        if (new_capacity <= capacity_)
+        {
+            return;
+        }
+        if (::ftruncate(fd_, static_cast<off_t>(new_capacity * sizeof(T))) != 0)
+        {
+            mapped_detail::throw_errno("ftruncate");
+        }
+        map_(new_capacity);
+    }
+
+    template <typename T>
+    void MappedVector<T>::push_back(const_reference value)
+    {
+        static_assert(!kConst, "MappedVector<const T> is read-only");
+        require_writable_();
+        if (size_ == capacity_)
+        {
+            value_type copy(value);
+            reserve(capacity_ ? capacity_ * 2 : 4096 / sizeof(T) + 1);
+            arr_[size_++] = copy;
+            return;
+        }
+        arr_[size_++] = value;
+    }
+
+    template <typename T>
+    void MappedVector<T>::sync()
+    {
+        if (arr_ && mode_ == MapMode::kReadWrite &&
+            ::msync(raw_(), capacity_ * sizeof(T), MS_SYNC) != 0)
+        {
+            mapped_detail::throw_errno("msync");
+        }
+    }
+
+    template <typename T>
+    void MappedVector<T>::map_(size_type capacity)
+    {
+        size_t bytes = capacity * sizeof(T);
+        if (bytes == 0)
+        {
+            unmap_();
+            return;
+        }
+        void *p = MAP_FAILED;
+#if defined(__linux__)
+        if (arr_)
+        {
+            p = ::mremap(raw_(), capacity_ * sizeof(T), bytes, MREMAP_MAYMOVE);
+        }
+#endif
+        if (p == MAP_FAILED)
+        {
+            int prot = mode_ == MapMode::kReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+            int flags = mode_ == MapMode::kCopyOnWrite ? MAP_PRIVATE : MAP_SHARED;
+            p = ::mmap(nullptr, bytes, prot, flags, fd_, 0);
+            if (p == MAP_FAILED)
+            {
+                mapped_detail::throw_errno("mmap");
+            }
+            unmap_();
+        }
+        arr_ = static_cast<T *>(p);
+        capacity_ = capacity;
+        ::madvise(raw_(), bytes, mapped_detail::advice(access_));
+    }
+
+    template <typename T>
+    void MappedVector<T>::unmap_()
+    {
+        if (arr_)
+        {
+            ::munmap(raw_(), capacity_ * sizeof(T));
+            arr_ = nullptr;
+            capacity_ = 0;
+        }
+    }
+
+    // запас, выделенный reserve, обрезается, чтобы в файле остались
+    // только записанные элементы
+    template <typename T>
+    void MappedVector<T>::close_()
+    {
+        bool trim = mode_ == MapMode::kReadWrite && capacity_ > size_;
+        unmap_();
+        if (fd_ >= 0)
+        {
+            if (trim)
+            {
+                (void)::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T)));
+            }
+            ::close(fd_);
+            fd_ = -1;
+        }
+        size_ = 0;
+    }
+
+    template <typename T>
+    void MappedVector<T>::require_writable_() const
+    {
+        if (mode_ != MapMode::kReadWrite)
+        {
+            throw std::logic_error("MappedVector is not opened for writing");
+        }
+    }
+}
+
+#endif // S21_MAPPED_VECTOR_H
@@ -0,0 +1,393 @@
+#ifndef S21_SOA_VECTOR_H
+#define S21_SOA_VECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_config.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Непрерывный участок одного столбца
+    template <typename T>
+    class Span
+    {
+    public:
+        using value_type = std::remove_const_t<T>;
+        using iterator = T *;
+
+        Span() = default;
+        Span(T *data, size_t size) : data_(data), size_(size) {}
+
+        T *data() const { return data_; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        T *begin() const { return data_; }
+        T *end() const { return data_ + size_; }
+        T &operator[](size_t pos) const
+        {
+            DefaultBoundsCheck::check(pos, size_);
+            return data_[pos];
+        }
+
+    private:
+        T *data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    // Таблица, где каждое поле Fields... лежит в своём s21::Vector.
+    // Строка i - кортеж ссылок на i-е элементы столбцов; проход по
+    // одному полю читает только его столбец. Изменяющие операции
+    // меняют все столбцы сразу, поэтому их длины всегда равны.
+    template <typename... Fields>
+    class SoAVector
+    {
+        static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+        using Columns = std::tuple<Vector<Fields>...>;
+        using Indices = std::index_sequence_for<Fields...>;
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields &...>;
+        using const_reference = std::tuple<const Fields &...>;
+        using size_type = size_t;
+
+        template <size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        // итератор по строкам; разыменование даёт кортеж ссылок
+        template <bool Const>
+        class RowIterator
+        {
+            using Owner = std::conditional_t<Const, const SoAVector, SoAVector>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = SoAVector::value_type;
+            using difference_type = ptrdiff_t;
+            using reference = std::conditional_t<Const, SoAVector::const_reference,
+                                                 SoAVector::reference>;
+            using pointer = void;
+
+            RowIterator() = default;
+            RowIterator(Owner *owner, size_type pos) : owner_(owner), pos_(pos) {}
+
+            reference operator*() const { return (*owner_)[pos_]; }
+            reference operator[](difference_type n) const { return (*owner_)[pos_ + n]; }
+            RowIterator &operator++()
+            {
+                ++pos_;
+                return *this;
+            }
+            RowIterator operator++(int) { return RowIterator(owner_, pos_++); }
+            RowIterator &operator--()
+            {
+                --pos_;
+                return *this;
+            }
+            RowIterator operator--(int) { return RowIterator(owner_, pos_--); }
+            RowIterator &operator+=(difference_type n)
+            {
+                pos_ += n;
+                return *this;
+            }
+            RowIterator &operator-=(difference_type n)
+            {
+                pos_ -= n;
+                return *this;
+            }
+            friend RowIterator operator+(RowIterator it, difference_type n) { return it += n; }
+            friend RowIterator operator-(RowIterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const RowIterator &a, const RowIterator &b)
+            {
+                return difference_type(a.pos_) - difference_type(b.pos_);
+            }
+            friend bool operator==(const RowIterator &a, const RowIterator &b) { return a.pos_ == b.pos_; }
+            friend bool operator!=(const RowIterator &a, const RowIterator &b) { return a.pos_ != b.pos_; }
+            friend bool operator<(const RowIterator &a, const RowIterator &b) { return a.pos_ < b.pos_; }
+
+            size_type index() const { return pos_; }
+
+        private:
+            Owner *owner_ = nullptr;
+            size_type pos_ = 0;
+        };
+
+        using iterator = RowIterator<false>;
+        using const_iterator = RowIterator<true>;
+
+        SoAVector() = default;
+        explicit SoAVector(size_type n) : columns_(Vector<Fields>(n)...) {}
+
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        reference front() { return (*this)[0]; }
+        reference back() { return (*this)[size() - 1]; }
+
+        // столбец I целиком: непрерывный массив для векторных проходов
+        template <size_t I>
+        Span<field_type<I>> column();
+        template <size_t I>
+        Span<const field_type<I>> column() const;
+        template <size_t I>
+        field_type<I> *data() { return std::get<I>(columns_).data(); }
+        template <size_t I>
+        const field_type<I> *data() const { return std::get<I>(columns_).data(); }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, size()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size()); }
+
+        bool empty() const { return size() == 0; }
+        size_type size() const { return std::get<0>(columns_).size(); }
+        size_type capacity() const;
+        void reserve(size_type new_capacity);
+        void shrink_to_fit();
+
+        void clear();
+        void push_back(const value_type &row);
+        void push_back(value_type &&row);
+        // по одному аргументу на поле
+        template <typename... Args>
+        reference emplace_back(Args &&...args);
+        void pop_back();
+        void erase(size_type pos);
+        void erase(size_type first, size_type last);
+        void resize(size_type count);
+        void swap(SoAVector &other) { columns_.swap(other.columns_); }
+
+    private:
+        template <size_t... I>
+        reference row_(size_type pos, std::index_sequence<I...>)
+        {
+            return reference(std::get<I>(columns_).data()[pos]...);
+        }
+        template <size_t... I>
+        const_reference row_(size_type pos, std::index_sequence<I...>) const
+        {
+            return const_reference(std::get<I>(columns_).data()[pos]...);
+        }
+        template <size_t... I, typename... Args>
+        void emplace_back_(std::index_sequence<I...>, Args &&...args);
+        template <size_t... I, typename Row>
+        void push_row_(std::index_sequence<I...>, Row &&row);
+        template <typename F>
+        void for_each_column_(F &&f);
+        void grow_for_one_();
+
+        Columns columns_;
+    };
+
+    template <typename... Fields>
+    typename SoAVector<Fields...>::reference SoAVector<Fields...>::at(size_type pos)
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return row_(pos, Indices{});
+    }
+
+    template <typename... Fields>
+    typename SoAVector<Fields...>::const_reference
+    SoAVector<Fields...>::at(size_type pos) const
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return row_(pos, Indices{});
+    }
+
+    template <typename... Fields>
+    typename SoAVector<Fields...>::reference
+    SoAVector<Fields...>::operator[](size_type pos)
+    {
+        DefaultBoundsCheck::check(pos, size());
+        return row_(pos, Indices{});
+    }
+
+    template <typename... Fields>
+    typename SoAVector<Fields...>::const_reference
+    SoAVector<Fields...>::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, size());
+        return row_(pos, Indices{});
+    }
+
+    template <typename... Fields>
+    template <size_t I>
+    Span<typename SoAVector<Fields...>::template field_type<I>>
+    SoAVector<Fields...>::column()
+    {
+        auto &col = std::get<I>(columns_);
+        return {col.data(), col.size()};
+    }
+
+    template <typename... Fields>
+    template <size_t I>
+    Span<const typename SoAVector<Fields...>::template field_type<I>>
+    SoAVector<Fields...>::column() const
+    {
+        const auto &col = std::get<I>(columns_);
+        return {col.data(), col.size()};
+    }
+
+    // ёмкость всех столбцов одинакова: её меняют только reserve и
+    // grow_for_one_, которые проходят по всем столбцам
+    template <typename... Fields>
+    typename SoAVector<Fields...>::size_type SoAVector<Fields...>::capacity() const
+    {
+        return std::get<0>(columns_).capacity();
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::reserve(size_type new_capacity)
+    {
+        for_each_column_([new_capacity](auto &col)
+                         { col.reserve(new_capacity); });
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::shrink_to_fit()
+    {
+        for_each_column_([](auto &col)
+                         { col.shrink_to_fit(); });
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::clear()
+    {
+        for_each_column_([](auto &col)
+                         { col.clear(); });
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::push_back(const value_type &row)
+    {
+        push_row_(Indices{}, row);
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::push_back(value_type &&row)
+    {
+        push_row_(Indices{}, std::move(row));
+    }
+
+    template <typename... Fields>
+    template <typename... Args>
+    typename SoAVector<Fields...>::reference
+    SoAVector<Fields...>::emplace_back(Args &&...args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Fields),
+                      "emplace_back takes one argument per field");
+        emplace_back_(Indices{}, std::forward<Args>(args)...);
+        return back();
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::pop_back()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Vector is empty");
+        }
+        for_each_column_([](auto &col)
+                         { col.pop_back(); });
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::erase(size_type pos)
+    {
+        erase(pos, pos + 1);
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::erase(size_type first, size_type last)
+    {
+        if (first > last || last > size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        for_each_column_([first, last](auto &col)
+                         { col.erase(col.begin() + first, col.begin() + last); });
+    }
+
+    template <typename... Fields>
+    void SoAVector<Fields...>::resize(size_type count)
+    {
+        if (count > capacity())
+        {
+            reserve(count);
+        }
+        for_each_column_([count](auto &col)
+                         { col.resize(count); });
+    }
+
+    // Сначала место выделяется во всех столбцах, затем элементы
+    // конструируются по очереди; если конструктор поля бросит
+    // исключение, уже добавленные поля строки снимаются. Как и в
+    // Vector::emplace_back, при полной таблице строка сперва собирается
+    // во временный кортеж: аргументы могут ссылаться на строки, которые
+    // переедут при росте.
+    template <typename... Fields>
+    template <size_t... I, typename... Args>
+    void SoAVector<Fields...>::emplace_back_(std::index_sequence<I...> seq, Args &&...args)
+    {
+        if (size() == capacity())
+        {
+            std::tuple<Fields...> tmp(std::forward<Args>(args)...);
+            grow_for_one_();
+            emplace_back_(seq, std::get<I>(std::move(tmp))...);
+            return;
+        }
+        size_t done = 0;
+        try
+        {
+            ((std::get<I>(columns_).emplace_back(std::forward<Args>(args)), ++done), ...);
+        }
+        catch (...)
+        {
+            ((I < done ? std::get<I>(columns_).pop_back() : void()), ...);
+            throw;
+        }
+    }
+
+    template <typename... Fields>
+    template <size_t... I, typename Row>
+    void SoAVector<Fields...>::push_row_(std::index_sequence<I...> seq, Row &&row)
+    {
+        emplace_back_(seq, std::get<I>(std::forward<Row>(row))...);
+    }
+
+    template <typename... Fields>
+    template <typename F>
+    void SoAVector<Fields...>::for_each_column_(F &&f)
+    {
+        std::apply([&f](auto &...col)
+                   { (f(col), ...); },
+                   columns_);
+    }
+
+    // все столбцы растут одновременно по политике GrowDouble
+    template <typename... Fields>
+    void SoAVector<Fields...>::grow_for_one_()
+    {
+        const auto &first = std::get<0>(columns_);
+        if (first.size() == first.capacity())
+        {
+            reserve(GrowDouble::grow(first.capacity(), first.max_size()));
+        }
+    }
+}
+
+#endif // S21_SOA_VECTOR_H
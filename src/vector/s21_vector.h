@@ -1,12 +1,27 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <cstring>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_alloc_stats.h"
+#include "../s21_config.h"
+#include "../s21_serialize.h"
+#include "s21_vector_memory.h"
+#include "s21_vector_policy.h"
 namespace s21
 {
-    template <typename T>
-    class Vector
+    // Growth - политика роста ёмкости, Memory - источник буферов
+    // (см. s21_vector_policy.h)
+    template <typename T, typename Growth = GrowDouble,
+              typename Memory = HeapMemory>
+    class Vector : private alloc_stats::Tracker<>
     {
     private:
         size_t m_size;
@@ -36,9 +51,11 @@ namespace s21
 
         reference at(size_type pos);
         reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
         const_reference front();
         const_reference back();
         T *data();
+        const T *data() const;
 
         iterator begin(); // Итератор на начало
         iterator end();   // Итератор на конец
@@ -52,10 +69,49 @@ namespace s21
 
         void clear();
         iterator insert(iterator pos, const_reference value);
+        iterator insert(iterator pos, size_type count, const_reference value);
+        template <typename InputIt,
+                  typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+        iterator insert(iterator pos, InputIt first, InputIt last);
         void erase(iterator pos);
+        iterator erase(iterator first, iterator last);
         void push_back(const_reference value);
+        void push_back(value_type &&value);
+        template <typename... Args>
+        reference emplace_back(Args &&...args);
         void pop_back();
         void swap(Vector &other);
+
+        void assign(size_type count, const_reference value);
+        template <typename InputIt,
+                  typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+        void assign(InputIt first, InputIt last);
+        void assign(std::initializer_list<value_type> items);
+        void resize(size_type count);
+        void resize(size_type count, const_reference value);
+
+        // двоичное сохранение/загрузка (формат в s21_serialize.h)
+        void save(std::ostream &out) const;
+        void load(std::istream &in);
+        void save(int fd) const;
+        void load(int fd);
+
+        // счётчики выделений этого вектора (нули при S21_ALLOC_STATS=0)
+        using alloc_stats::Tracker<>::alloc_stats;
+
+    private:
+        // буфер хранит [0, m_size) сконструированных элементов,
+        // [m_size, m_capacity) - сырая память
+        static bool mapped_(size_type n);
+        T *allocate_(size_type n);
+        void deallocate_(T *p, size_type n);
+        static void destroy_(T *first, T *last);
+        static void relocate_(T *src, size_type n, T *dst);
+        void reallocate_(size_type new_capacity);
+        bool remaps_(size_type new_capacity) const;
+        size_type recommend_(size_type new_size) const;
+        T *make_gap_(size_type index, size_type count);
+        void close_gap_(size_type index, size_type count);
     };
 }
 #include "s21_vector.tpp"
@@ -2,45 +2,48 @@
 namespace s21
 {
     // Конструктор по умолчанию
-    template <typename T>
-    Vector<T>::Vector() : m_size(0), m_capacity(0), arr(nullptr) {}
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory>::Vector() : m_size(0), m_capacity(0), arr(nullptr) {}
 
     // Конструктор с параметром
-    template <typename T>
-    Vector<T>::Vector(size_type n)
-        : m_size(n), m_capacity(n), arr(n ? new T[n] : nullptr) {}
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory>::Vector(size_type n)
+        : m_size(n), m_capacity(n), arr(allocate_(n))
+    {
+        std::uninitialized_value_construct_n(arr, n);
+    }
 
     // Конструктор копирования
-    template <typename T>
-    Vector<T>::Vector(const Vector &v)
-        : m_size(v.m_size), m_capacity(v.m_capacity), arr(new T[v.m_size])
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory>::Vector(const Vector &v)
+        : alloc_stats::Tracker<>(), m_size(v.m_size), m_capacity(v.m_size), arr(allocate_(v.m_size))
     {
-        for (size_type i = 0; i < m_size; ++i)
-        {
-            arr[i] = v.arr[i];
-        }
+        std::uninitialized_copy_n(v.arr, m_size, arr);
     }
 
     // конструктор перемещения
-    template <typename T>
-    Vector<T>::Vector(Vector &&v)
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory>::Vector(Vector &&v)
         : m_size(v.m_size), m_capacity(v.m_capacity), arr(v.arr)
     {
+        take_alloc_stats_(v);
         v.arr = nullptr;
         v.m_size = 0;
         v.m_capacity = 0;
     }
 
-    template <typename T>
-    Vector<T> &Vector<T>::operator=(Vector &&v)
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory> &Vector<T, Growth, Memory>::operator=(Vector &&v)
     {
         if (this != &v)
         {
-            delete[] arr;
+            destroy_(arr, arr + m_size);
+            deallocate_(arr, m_capacity);
 
             arr = v.arr;
             m_size = v.m_size;
             m_capacity = v.m_capacity;
+            take_alloc_stats_(v);
 
             v.arr = nullptr;
             v.m_size = 0;
@@ -48,8 +51,8 @@ namespace s21
         }
         return *this;
     }
-    template <typename T>
-    typename Vector<T>::reference &Vector<T>::at(size_type pos)
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::reference &Vector<T, Growth, Memory>::at(size_type pos)
     {
         if (pos >= m_size)
         {
@@ -58,18 +61,23 @@ namespace s21
         return arr[pos];
     }
 
-    template <typename T>
-    typename Vector<T>::reference &Vector<T>::operator[](size_type pos)
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::reference &Vector<T, Growth, Memory>::operator[](size_type pos)
     {
-        if (pos >= m_size)
-        {
-            throw std::out_of_range("Index out of range");
-        }
+        // проверка задаётся S21_BOUNDS_CHECK (см. s21_config.h)
+        DefaultBoundsCheck::check(pos, m_size);
+        return arr[pos];
+    }
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::const_reference
+    Vector<T, Growth, Memory>::operator[](size_type pos) const
+    {
+        DefaultBoundsCheck::check(pos, m_size);
         return arr[pos];
     }
     // первый элемент
-    template <typename T>
-    typename Vector<T>::const_reference &Vector<T>::front()
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::const_reference &Vector<T, Growth, Memory>::front()
     {
         if (!m_size)
         {
@@ -79,8 +87,8 @@ namespace s21
     }
 
     // последний элемент
-    template <typename T>
-    typename Vector<T>::const_reference &Vector<T>::back()
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::const_reference &Vector<T, Growth, Memory>::back()
     {
         if (!m_size)
         {
@@ -89,145 +97,246 @@ namespace s21
         return arr[m_size - 1];
     }
 
-    template <typename T>
-    T *Vector<T>::data()
+    template <typename T, typename Growth, typename Memory>
+    T *Vector<T, Growth, Memory>::data()
+    {
+        return arr;
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    const T *Vector<T, Growth, Memory>::data() const
     {
         return arr;
     }
 
-    template <typename T>
-    bool Vector<T>::empty() const
+    template <typename T, typename Growth, typename Memory>
+    bool Vector<T, Growth, Memory>::empty() const
     {
         return m_size == 0;
     }
 
-    template <typename T>
-    typename Vector<T>::size_type Vector<T>::size() const
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::size_type Vector<T, Growth, Memory>::size() const
     {
         return m_size;
     }
 
-    template <typename T>
-    typename Vector<T>::size_type Vector<T>::capacity() const
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::size_type Vector<T, Growth, Memory>::capacity() const
     {
         return m_capacity;
     }
 
-    template <typename T>
-    void Vector<T>::clear()
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::clear()
     {
-        delete[] arr;
+        destroy_(arr, arr + m_size);
+        deallocate_(arr, m_capacity);
         arr = nullptr;
         m_size = 0;
         m_capacity = 0;
     }
 
     // Деструктор
-    template <typename T>
-    Vector<T>::~Vector()
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory>::~Vector()
     {
-        delete[] arr;
+        destroy_(arr, arr + m_size);
+        deallocate_(arr, m_capacity);
     }
 
-    template <typename T>
-    typename Vector<T>::iterator Vector<T>::begin()
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::iterator Vector<T, Growth, Memory>::begin()
     {
         return arr;
     }
 
-    template <typename T>
-    typename Vector<T>::iterator Vector<T>::end()
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::iterator Vector<T, Growth, Memory>::end()
     {
         return arr + m_size;
     }
 
-    template <typename T>
-    typename Vector<T>::size_type Vector<T>::max_size() const
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::size_type Vector<T, Growth, Memory>::max_size() const
     {
         return std::numeric_limits<size_type>::max() / sizeof(T);
     }
 
-    template <typename T>
-    void Vector<T>::reserve(size_type new_capacity)
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::reserve(size_type new_capacity)
     {
-        if (new_capacity > m_capacity)
+        if (new_capacity > max_size())
         {
-            T *new_arr = new T[new_capacity];
-            for (int i = 0; i < m_size; ++i)
-            {
-                new_arr[i] = arr[i];
-            }
-            delete[] arr;
-            arr = new_arr;
-            m_capacity = new_capacity;
+            throw std::length_error("Can't allocate memory of this size");
         }
-        else
+        if (new_capacity > m_capacity)
         {
-            throw std::length_error("Can't allocate memory of this size");
+            reallocate_(new_capacity);
         }
     }
 
-    template <typename T>
-    void Vector<T>::shrink_to_fit()
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::shrink_to_fit()
     {
         if (m_size < m_capacity)
         {
-            T *new_arr = new T[m_size];
-            for (size_type i = 0; i < m_size; ++i)
-            {
-                new_arr[i] = std::move(arr[i]);
-            }
-            delete[] arr;
-            arr = new_arr;
-            m_capacity = m_size;
+            reallocate_(m_size);
         }
     }
-    template <typename T>
-    typename Vector<T>::iterator Vector<T>::insert(iterator pos, const_reference value)
+
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::iterator
+    Vector<T, Growth, Memory>::insert(iterator pos, const_reference value)
+    {
+        return insert(pos, 1, value);
+    }
+
+    // вставка count копий value одним сдвигом хвоста
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::iterator
+    Vector<T, Growth, Memory>::insert(iterator pos, size_type count, const_reference value)
     {
         size_type index = pos - arr;
-        if (m_size >= m_capacity)
+        if (count == 0)
         {
-            reserve(m_capacity ? m_capacity * 2 : 1);
+            return arr + index;
         }
-
-        for (size_type i = m_size; i > index; --i)
+        // value может ссылаться на элемент самого вектора
+        T copy(value);
+        T *gap = make_gap_(index, count);
+        try
         {
-            arr[i] = std::move(arr[i - 1]);
+            std::uninitialized_fill_n(gap, count, copy);
         }
-        arr[index] = value;
-        ++m_size;
-        return arr + index;
+        catch (...)
+        {
+            close_gap_(index, count);
+            throw;
+        }
+        m_size += count;
+        return gap;
     }
 
-    template <typename T>
-    void Vector<T>::erase(iterator pos)
+    // вставка диапазона [first, last), который не должен указывать в *this
+    template <typename T, typename Growth, typename Memory>
+    template <typename InputIt, typename>
+    typename Vector<T, Growth, Memory>::iterator
+    Vector<T, Growth, Memory>::insert(iterator pos, InputIt first, InputIt last)
     {
         size_type index = pos - arr;
-        for (size_type i = index; i < m_size - 1; ++i)
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
         {
-            arr[i] = std::move(arr[i + 1]);
+            size_type count = std::distance(first, last);
+            if (count == 0)
+            {
+                return arr + index;
+            }
+            T *gap = make_gap_(index, count);
+            try
+            {
+                std::uninitialized_copy(first, last, gap);
+            }
+            catch (...)
+            {
+                close_gap_(index, count);
+                throw;
+            }
+            m_size += count;
+            return gap;
+        }
+        else
+        {
+            // длина неизвестна заранее: копим во временный вектор
+            Vector tmp;
+            for (; first != last; ++first)
+            {
+                tmp.push_back(*first);
+            }
+            return insert(arr + index, tmp.begin(), tmp.end());
         }
-        --m_size;
     }
 
-    template <typename T>
-    void Vector<T>::push_back(const_reference value)
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::erase(iterator pos)
+    {
+        erase(pos, pos + 1);
+    }
+
+    // удаление [first, last) одним сдвигом хвоста
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::iterator
+    Vector<T, Growth, Memory>::erase(iterator first, iterator last)
+    {
+        if (first == last)
+        {
+            return first;
+        }
+        size_type count = last - first;
+        size_type tail = (arr + m_size) - last;
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(static_cast<void *>(first), last, tail * sizeof(T));
+        }
+        else
+        {
+            std::move(last, arr + m_size, first);
+        }
+        destroy_(arr + m_size - count, arr + m_size);
+        m_size -= count;
+        return first;
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::push_back(const_reference value)
     {
         if (m_size >= m_capacity)
         {
-            reserve(m_capacity ? m_capacity * 2 : 1);
+            // value может ссылаться на элемент, который переедет
+            T copy(value);
+            reallocate_(recommend_(m_size + 1));
+            ::new (static_cast<void *>(arr + m_size)) T(std::move(copy));
+        }
+        else
+        {
+            ::new (static_cast<void *>(arr + m_size)) T(value);
         }
-        arr[m_size] = value;
         ++m_size;
     }
 
-    template <typename T>
-    void Vector<T>::pop_back()
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::push_back(value_type &&value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    template <typename... Args>
+    typename Vector<T, Growth, Memory>::reference
+    Vector<T, Growth, Memory>::emplace_back(Args &&...args)
+    {
+        if (m_size >= m_capacity)
+        {
+            // аргументы могут ссылаться на элементы, которые переедут
+            T tmp(std::forward<Args>(args)...);
+            reallocate_(recommend_(m_size + 1));
+            ::new (static_cast<void *>(arr + m_size)) T(std::move(tmp));
+        }
+        else
+        {
+            ::new (static_cast<void *>(arr + m_size)) T(std::forward<Args>(args)...);
+        }
+        return arr[m_size++];
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::pop_back()
     {
         if (m_size > 0)
         {
             --m_size;
+            destroy_(arr + m_size, arr + m_size + 1);
         }
         else
         {
@@ -235,8 +344,8 @@ namespace s21
         }
     }
 
-    template <typename T>
-    void Vector<T>::swap(Vector &other)
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::swap(Vector &other)
     {
         T *tempArr = arr;
         arr = other.arr;
@@ -249,20 +358,335 @@ namespace s21
         size_type tempCapacity = m_capacity;
         m_capacity = other.m_capacity;
         other.m_capacity = tempCapacity;
+        swap_alloc_stats_(other);
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::assign(size_type count, const_reference value)
+    {
+        T copy(value);
+        destroy_(arr, arr + m_size);
+        m_size = 0;
+        if (count > m_capacity)
+        {
+            deallocate_(arr, m_capacity);
+            arr = nullptr;
+            m_capacity = 0;
+            arr = allocate_(count);
+            m_capacity = count;
+        }
+        std::uninitialized_fill_n(arr, count, copy);
+        m_size = count;
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    template <typename InputIt, typename>
+    void Vector<T, Growth, Memory>::assign(InputIt first, InputIt last)
+    {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+        {
+            size_type count = std::distance(first, last);
+            destroy_(arr, arr + m_size);
+            m_size = 0;
+            if (count > m_capacity)
+            {
+                deallocate_(arr, m_capacity);
+                arr = nullptr;
+                m_capacity = 0;
+                arr = allocate_(count);
+                m_capacity = count;
+            }
+            std::uninitialized_copy(first, last, arr);
+            m_size = count;
+        }
+        else
+        {
+            destroy_(arr, arr + m_size);
+            m_size = 0;
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+        }
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::assign(std::initializer_list<value_type> items)
+    {
+        assign(items.begin(), items.end());
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::resize(size_type count)
+    {
+        if (count > m_size)
+        {
+            if (count > m_capacity)
+            {
+                reallocate_(recommend_(count));
+            }
+            std::uninitialized_value_construct(arr + m_size, arr + count);
+        }
+        else
+        {
+            destroy_(arr + count, arr + m_size);
+        }
+        m_size = count;
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::resize(size_type count, const_reference value)
+    {
+        if (count > m_size)
+        {
+            insert(arr + m_size, count - m_size, value);
+        }
+        else
+        {
+            destroy_(arr + count, arr + m_size);
+            m_size = count;
+        }
+    }
+
+    // тривиально копируемые элементы пишутся одним блоком
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::save(std::ostream &out) const
+    {
+        constexpr bool pod = std::is_trivially_copyable_v<T>;
+        serialize::write_header(out, serialize::kVector, pod, sizeof(T), m_size);
+        if constexpr (pod)
+        {
+            serialize::write_bytes(out, arr, m_size * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = 0; i < m_size; ++i)
+            {
+                serialize::write_value(out, arr[i]);
+            }
+        }
     }
 
-    template <typename T>
-    Vector<T>::Vector(std::initializer_list<value_type> const &items)
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::load(std::istream &in)
     {
-        arr = new value_type[items.size()];
-        int i = 0;
-        for (auto it = items.begin(); it != items.end(); it++)
+        constexpr bool pod = std::is_trivially_copyable_v<T>;
+        uint64_t count = serialize::read_header(in, serialize::kVector, pod, sizeof(T));
+        Vector tmp;
+        if constexpr (pod)
+        {
+            if (count > max_size())
+            {
+                throw std::length_error("Can't allocate memory of this size");
+            }
+            while (tmp.m_size < count)
+            {
+                size_type part = serialize::read_chunk(count - tmp.m_size, tmp.m_size, sizeof(T));
+                tmp.reserve(tmp.m_size + part);
+                serialize::read_bytes(in, tmp.arr + tmp.m_size, part * sizeof(T));
+                tmp.m_size += part;
+            }
+        }
+        else
         {
-            arr[i] = *it;
-            i++;
+            tmp.reserve(serialize::reserve_hint(count));
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                T value;
+                serialize::read_value(in, value);
+                tmp.push_back(std::move(value));
+            }
         }
-        m_size = items.size();
-        m_capacity = items.size();
+        swap(tmp);
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::save(int fd) const
+    {
+        serialize::save_fd(*this, fd);
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::load(int fd)
+    {
+        serialize::load_fd(*this, fd);
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    Vector<T, Growth, Memory>::Vector(std::initializer_list<value_type> const &items)
+        : m_size(items.size()), m_capacity(items.size()),
+          arr(allocate_(items.size()))
+    {
+        std::uninitialized_copy(items.begin(), items.end(), arr);
     };
 
+    template <typename T, typename Growth, typename Memory>
+    bool Vector<T, Growth, Memory>::mapped_(size_type n)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            return vector_memory::is_mapped(n * sizeof(T));
+        }
+        return false;
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    T *Vector<T, Growth, Memory>::allocate_(size_type n)
+    {
+        if (!n)
+        {
+            return nullptr;
+        }
+        T *p = mapped_(n) ? static_cast<T *>(vector_memory::map(n * sizeof(T)))
+                          : Memory::template allocate<T>(n);
+        on_allocate_(alloc_stats::Source::kVector, n * sizeof(T));
+        return p;
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::deallocate_(T *p, size_type n)
+    {
+        if (!p)
+        {
+            return;
+        }
+        on_free_(alloc_stats::Source::kVector, n * sizeof(T));
+        if (mapped_(n))
+        {
+            vector_memory::unmap(p, n * sizeof(T));
+        }
+        else
+        {
+            Memory::deallocate(p, n);
+        }
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::destroy_(T *first, T *last)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            std::destroy(first, last);
+        }
+    }
+
+    // перенос n элементов из src в неинициализированную память dst
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::relocate_(T *src, size_type n, T *dst)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (n)
+            {
+                std::memcpy(static_cast<void *>(dst), src, n * sizeof(T));
+            }
+        }
+        else
+        {
+            std::uninitialized_move_n(src, n, dst);
+            destroy_(src, src + n);
+        }
+    }
+
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::reallocate_(size_type new_capacity)
+    {
+        on_reallocate_(alloc_stats::Source::kVector, new_capacity * sizeof(T));
+        if (remaps_(new_capacity))
+        {
+            arr = static_cast<T *>(vector_memory::remap(
+                arr, m_capacity * sizeof(T), new_capacity * sizeof(T)));
+            on_resize_(m_capacity * sizeof(T), new_capacity * sizeof(T));
+            m_capacity = new_capacity;
+            return;
+        }
+        T *new_arr = allocate_(new_capacity);
+        relocate_(arr, m_size, new_arr);
+        deallocate_(arr, m_capacity);
+        arr = new_arr;
+        m_capacity = new_capacity;
+    }
+
+    // старый и новый буферы отображены страницами: растём через mremap
+    template <typename T, typename Growth, typename Memory>
+    bool Vector<T, Growth, Memory>::remaps_(size_type new_capacity) const
+    {
+        return arr && new_capacity && mapped_(m_capacity) && mapped_(new_capacity);
+    }
+
+    // ёмкость, достаточная для new_size элементов
+    template <typename T, typename Growth, typename Memory>
+    typename Vector<T, Growth, Memory>::size_type
+    Vector<T, Growth, Memory>::recommend_(size_type new_size) const
+    {
+        if (new_size > max_size())
+        {
+            throw std::length_error("Can't allocate memory of this size");
+        }
+        size_type grown = Growth::grow(m_capacity, max_size());
+        return grown > new_size ? grown : new_size;
+    }
+
+    // освобождает count неинициализированных ячеек начиная с index;
+    // при нехватке места выделяет память один раз и переносит
+    // обе части сразу на свои места (или растёт через mremap)
+    template <typename T, typename Growth, typename Memory>
+    T *Vector<T, Growth, Memory>::make_gap_(size_type index, size_type count)
+    {
+        size_type tail = m_size - index;
+        if (m_size + count > m_capacity)
+        {
+            size_type new_capacity = recommend_(m_size + count);
+            if (!remaps_(new_capacity))
+            {
+                on_reallocate_(alloc_stats::Source::kVector, new_capacity * sizeof(T));
+                T *new_arr = allocate_(new_capacity);
+                relocate_(arr, index, new_arr);
+                relocate_(arr + index, tail, new_arr + index + count);
+                deallocate_(arr, m_capacity);
+                arr = new_arr;
+                m_capacity = new_capacity;
+                return arr + index;
+            }
+            reallocate_(new_capacity);
+        }
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(static_cast<void *>(arr + index + count), arr + index,
+                         tail * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = m_size; i > index; --i)
+            {
+                ::new (static_cast<void *>(arr + i - 1 + count))
+                    T(std::move(arr[i - 1]));
+                arr[i - 1].~T();
+            }
+        }
+        return arr + index;
+    }
+
+    // откат make_gap_, когда заполнить дыру не удалось: uninitialized_*
+    // уже разрушили свои копии, дыра сырая - возвращаем хвост на место
+    template <typename T, typename Growth, typename Memory>
+    void Vector<T, Growth, Memory>::close_gap_(size_type index, size_type count)
+    {
+        T *hole = arr + index;
+        size_type tail = m_size - index;
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memmove(static_cast<void *>(hole), hole + count, tail * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = 0; i < tail; ++i)
+            {
+                ::new (static_cast<void *>(hole + i)) T(std::move(hole[i + count]));
+                hole[i + count].~T();
+            }
+        }
+    }
+
 } // namespace s21
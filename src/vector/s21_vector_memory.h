@@ -0,0 +1,191 @@
+#ifndef S21_VECTOR_MEMORY_H
+#define S21_VECTOR_MEMORY_H
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21
+{
+    // Большие буферы тривиально копируемых элементов берутся прямо
+    // у ядра через mmap, чтобы рост шёл через mremap без копирования.
+    namespace vector_memory
+    {
+#if defined(__linux__)
+        inline constexpr bool kCanRemap = true;
+#else
+        inline constexpr bool kCanRemap = false;
+#endif
+        // порог, начиная с которого буфер отображается страницами
+        inline constexpr size_t kMapThreshold = size_t(1) << 20;
+
+        inline bool is_mapped(size_t bytes)
+        {
+            return kCanRemap && bytes >= kMapThreshold;
+        }
+
+#if defined(__linux__)
+        inline size_t page_round(size_t bytes)
+        {
+            static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return (bytes + page - 1) & ~(page - 1);
+        }
+
+        inline void *map(size_t bytes)
+        {
+            void *p = mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            return p;
+        }
+
+        inline void unmap(void *p, size_t bytes)
+        {
+            munmap(p, page_round(bytes));
+        }
+
+        // страницы переезжают в ядре, содержимое не копируется
+        inline void *remap(void *p, size_t old_bytes, size_t new_bytes)
+        {
+            void *q = mremap(p, page_round(old_bytes), page_round(new_bytes),
+                             MREMAP_MAYMOVE);
+            if (q == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            return q;
+        }
+#else
+        inline void *map(size_t) { throw std::bad_alloc(); }
+        inline void unmap(void *, size_t) {}
+        inline void *remap(void *, size_t, size_t) { throw std::bad_alloc(); }
+#endif
+
+        // Потоковый кэш буферов, разложенных по классам размеров
+        // (степени двойки от 64 байт до kMapThreshold). Освобождённый
+        // буфер остаётся в своём классе, пока не превышены лимиты
+        // kMaxPerClass и kMaxCachedBytes, иначе отдаётся в кучу.
+        class BufferPool
+        {
+        public:
+            static constexpr size_t kMinClassShift = 6;
+            static constexpr size_t kClassCount = 15;
+            static constexpr size_t kMaxPerClass = 16;
+            static constexpr size_t kMaxCachedBytes = size_t(8) << 20;
+
+            struct Stats
+            {
+                size_t hits = 0;
+                size_t misses = 0;
+                size_t releases = 0;
+                size_t drops = 0;
+            };
+
+            static BufferPool &local()
+            {
+                thread_local BufferPool pool;
+                return pool;
+            }
+
+            BufferPool() = default;
+            BufferPool(const BufferPool &) = delete;
+            BufferPool &operator=(const BufferPool &) = delete;
+            ~BufferPool() { trim(); }
+
+            void *acquire(size_t bytes)
+            {
+                size_t cls = class_of(bytes);
+                if (cls >= kClassCount)
+                {
+                    return ::operator new(bytes);
+                }
+                Bucket &bucket = buckets_[cls];
+                if (bucket.count)
+                {
+                    ++stats_.hits;
+                    cached_bytes_ -= class_size(cls);
+                    return bucket.slots[--bucket.count];
+                }
+                ++stats_.misses;
+                return ::operator new(class_size(cls));
+            }
+
+            void release(void *p, size_t bytes)
+            {
+                size_t cls = class_of(bytes);
+                if (cls >= kClassCount)
+                {
+                    ::operator delete(p);
+                    return;
+                }
+                ++stats_.releases;
+                Bucket &bucket = buckets_[cls];
+                if (bucket.count == kMaxPerClass ||
+                    cached_bytes_ + class_size(cls) > kMaxCachedBytes)
+                {
+                    ++stats_.drops;
+                    ::operator delete(p);
+                    return;
+                }
+                bucket.slots[bucket.count++] = p;
+                cached_bytes_ += class_size(cls);
+            }
+
+            // вернуть все закэшированные буферы в кучу
+            void trim()
+            {
+                for (Bucket &bucket : buckets_)
+                {
+                    while (bucket.count)
+                    {
+                        ::operator delete(bucket.slots[--bucket.count]);
+                    }
+                }
+                cached_bytes_ = 0;
+            }
+
+            Stats stats() const { return stats_; }
+            void reset_stats() { stats_ = Stats{}; }
+            size_t cached_bytes() const { return cached_bytes_; }
+
+        private:
+            struct Bucket
+            {
+                void *slots[kMaxPerClass];
+                size_t count = 0;
+            };
+
+            static size_t class_of(size_t bytes)
+            {
+                if (bytes > class_size(kClassCount - 1))
+                {
+                    return kClassCount;
+                }
+                size_t cls = 0;
+                while ((size_t(1) << (cls + kMinClassShift)) < bytes)
+                {
+                    ++cls;
+                }
+                return cls;
+            }
+
+            static size_t class_size(size_t cls)
+            {
+                return size_t(1) << (cls + kMinClassShift);
+            }
+
+            Bucket buckets_[kClassCount];
+            size_t cached_bytes_ = 0;
+            Stats stats_;
+        };
+    }
+}
+
+#endif // S21_VECTOR_MEMORY_H
@@ -0,0 +1,103 @@
+#ifndef S21_VECTOR_POLICY_H
+#define S21_VECTOR_POLICY_H
+
+#include <cstddef>
+#include <memory>
+
+#include "s21_vector_memory.h"
+
+namespace s21
+{
+    // Политики роста ёмкости Vector. grow() получает текущую ёмкость
+    // и максимально допустимую, возвращает следующую ёмкость.
+
+    // удвоение (по умолчанию)
+    struct GrowDouble
+    {
+        static size_t grow(size_t capacity, size_t max)
+        {
+            if (capacity == 0)
+            {
+                return 1;
+            }
+            return capacity > max / 2 ? max : capacity * 2;
+        }
+    };
+
+    // рост в 1.5 раза: не более трети памяти в запасе
+    struct GrowHalf
+    {
+        static size_t grow(size_t capacity, size_t max)
+        {
+            if (capacity < 2)
+            {
+                return capacity + 1;
+            }
+            return capacity > max - capacity / 2 ? max : capacity + capacity / 2;
+        }
+    };
+
+    // рост фиксированными порциями по Chunk элементов
+    template <size_t Chunk>
+    struct GrowChunk
+    {
+        static_assert(Chunk > 0, "chunk must be positive");
+
+        static size_t grow(size_t capacity, size_t max)
+        {
+            return capacity > max - Chunk ? max : capacity + Chunk;
+        }
+    };
+
+    // Политики памяти Vector: откуда берутся буферы меньше
+    // vector_memory::kMapThreshold.
+
+    // обычная куча (по умолчанию)
+    struct HeapMemory
+    {
+        template <typename T>
+        static T *allocate(size_t n)
+        {
+            return std::allocator<T>().allocate(n);
+        }
+
+        template <typename T>
+        static void deallocate(T *p, size_t n)
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+    };
+
+    // буферы переиспользуются через потоковый пул vector_memory::BufferPool
+    struct PooledMemory
+    {
+        template <typename T>
+        static T *allocate(size_t n)
+        {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return HeapMemory::allocate<T>(n);
+            }
+            else
+            {
+                return static_cast<T *>(
+                    vector_memory::BufferPool::local().acquire(n * sizeof(T)));
+            }
+        }
+
+        template <typename T>
+        static void deallocate(T *p, size_t n)
+        {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                HeapMemory::deallocate(p, n);
+            }
+            else
+            {
+                vector_memory::BufferPool::local().release(p, n * sizeof(T));
+            }
+        }
+    };
+}
+
+#endif // S21_VECTOR_POLICY_H
@@ -0,0 +1,812 @@
+#ifndef S21_VECTOR_SIMD_H
+#define S21_VECTOR_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#define S21_TARGET_SSE4 __attribute__((target("sse4.1,popcnt")))
+#define S21_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21
+{
+    // Векторизованные алгоритмы над непрерывными массивами арифметических
+    // типов. int32_t и float обрабатываются ядрами AVX2/SSE4.1, уровень
+    // выбирается один раз по cpuid; остальные типы и прочие платформы
+    // идут через скалярные циклы. Для float с NaN результат min_max
+    // не определён.
+    namespace simd
+    {
+        enum class Level
+        {
+            kScalar,
+            kSse4,
+            kAvx2
+        };
+
+        // тип суммы: double для плавающих, 64-битное целое для целых
+        template <typename T>
+        using sum_t = std::conditional_t<
+            std::is_floating_point_v<T>, double,
+            std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>>;
+
+        inline Level detect()
+        {
+#if S21_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+            {
+                return Level::kAvx2;
+            }
+            if (__builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("popcnt"))
+            {
+                return Level::kSse4;
+            }
+#endif
+            return Level::kScalar;
+        }
+
+        inline Level &active_level()
+        {
+            static Level level = detect();
+            return level;
+        }
+
+        // текущий уровень; force() понижает его для тестов и бенчмарков
+        inline Level active() { return active_level(); }
+        inline void force(Level level)
+        {
+            active_level() = level < detect() ? level : detect();
+        }
+
+        namespace scalar
+        {
+            template <typename T>
+            const T *find(const T *p, size_t n, T value)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (p[i] == value)
+                    {
+                        return p + i;
+                    }
+                }
+                return p + n;
+            }
+
+            template <typename T>
+            size_t count(const T *p, size_t n, T value)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    result += p[i] == value;
+                }
+                return result;
+            }
+
+            template <typename T>
+            sum_t<T> sum(const T *p, size_t n)
+            {
+                sum_t<T> result = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    result += p[i];
+                }
+                return result;
+            }
+
+            template <typename T>
+            std::pair<T, T> min_max(const T *p, size_t n)
+            {
+                T lo = p[0];
+                T hi = p[0];
+                for (size_t i = 1; i < n; ++i)
+                {
+                    lo = p[i] < lo ? p[i] : lo;
+                    hi = hi < p[i] ? p[i] : hi;
+                }
+                return {lo, hi};
+            }
+
+            template <typename T>
+            bool equal(const T *a, const T *b, size_t n)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (!(a[i] == b[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+#if S21_SIMD_X86
+        namespace sse4
+        {
+            S21_TARGET_SSE4 inline const int32_t *find(const int32_t *p, size_t n,
+                                                       int32_t value)
+            {
+                const __m128i v = _mm_set1_epi32(value);
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i eq = _mm_cmpeq_epi32(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), v);
+                    int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+                    if (mask)
+                    {
+                        return p + i + __builtin_ctz(mask);
+                    }
+                }
+                return scalar::find(p + i, n - i, value);
+            }
+
+            S21_TARGET_SSE4 inline const float *find(const float *p, size_t n,
+                                                     float value)
+            {
+                const __m128 v = _mm_set1_ps(value);
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v));
+                    if (mask)
+                    {
+                        return p + i + __builtin_ctz(mask);
+                    }
+                }
+                return scalar::find(p + i, n - i, value);
+            }
+
+            S21_TARGET_SSE4 inline size_t count(const int32_t *p, size_t n,
+                                                int32_t value)
+            {
+                const __m128i v = _mm_set1_epi32(value);
+                size_t result = 0;
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i eq = _mm_cmpeq_epi32(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), v);
+                    result += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+                }
+                return result + scalar::count(p + i, n - i, value);
+            }
+
+            S21_TARGET_SSE4 inline size_t count(const float *p, size_t n, float value)
+            {
+                const __m128 v = _mm_set1_ps(value);
+                size_t result = 0;
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    result += __builtin_popcount(
+                        _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v)));
+                }
+                return result + scalar::count(p + i, n - i, value);
+            }
+
+            S21_TARGET_SSE4 inline long long sum(const int32_t *p, size_t n)
+            {
+                __m128i acc0 = _mm_setzero_si128();
+                __m128i acc1 = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                    acc0 = _mm_add_epi64(acc0, _mm_cvtepi32_epi64(x));
+                    acc1 = _mm_add_epi64(acc1, _mm_cvtepi32_epi64(_mm_srli_si128(x, 8)));
+                }
+                alignas(16) long long lanes[2];
+                _mm_store_si128(reinterpret_cast<__m128i *>(lanes), _mm_add_epi64(acc0, acc1));
+                return lanes[0] + lanes[1] + scalar::sum(p + i, n - i);
+            }
+
+            S21_TARGET_SSE4 inline double sum(const float *p, size_t n)
+            {
+                __m128d acc0 = _mm_setzero_pd();
+                __m128d acc1 = _mm_setzero_pd();
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128 x = _mm_loadu_ps(p + i);
+                    acc0 = _mm_add_pd(acc0, _mm_cvtps_pd(x));
+                    acc1 = _mm_add_pd(acc1, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+                }
+                alignas(16) double lanes[2];
+                _mm_store_pd(lanes, _mm_add_pd(acc0, acc1));
+                return lanes[0] + lanes[1] + scalar::sum(p + i, n - i);
+            }
+
+            S21_TARGET_SSE4 inline std::pair<int32_t, int32_t> min_max(const int32_t *p,
+                                                                       size_t n)
+            {
+                if (n < 4)
+                {
+                    return scalar::min_max(p, n);
+                }
+                __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                __m128i hi = lo;
+                size_t i = 4;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                    lo = _mm_min_epi32(lo, x);
+                    hi = _mm_max_epi32(hi, x);
+                }
+                alignas(16) int32_t lo_lanes[4];
+                alignas(16) int32_t hi_lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i *>(lo_lanes), lo);
+                _mm_store_si128(reinterpret_cast<__m128i *>(hi_lanes), hi);
+                std::pair<int32_t, int32_t> result = scalar::min_max(lo_lanes, 4);
+                result.second = scalar::min_max(hi_lanes, 4).second;
+                for (; i < n; ++i)
+                {
+                    result.first = p[i] < result.first ? p[i] : result.first;
+                    result.second = result.second < p[i] ? p[i] : result.second;
+                }
+                return result;
+            }
+
+            S21_TARGET_SSE4 inline std::pair<float, float> min_max(const float *p,
+                                                                   size_t n)
+            {
+                if (n < 4)
+                {
+                    return scalar::min_max(p, n);
+                }
+                __m128 lo = _mm_loadu_ps(p);
+                __m128 hi = lo;
+                size_t i = 4;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128 x = _mm_loadu_ps(p + i);
+                    lo = _mm_min_ps(lo, x);
+                    hi = _mm_max_ps(hi, x);
+                }
+                alignas(16) float lo_lanes[4];
+                alignas(16) float hi_lanes[4];
+                _mm_store_ps(lo_lanes, lo);
+                _mm_store_ps(hi_lanes, hi);
+                std::pair<float, float> result = scalar::min_max(lo_lanes, 4);
+                result.second = scalar::min_max(hi_lanes, 4).second;
+                for (; i < n; ++i)
+                {
+                    result.first = p[i] < result.first ? p[i] : result.first;
+                    result.second = result.second < p[i] ? p[i] : result.second;
+                }
+                return result;
+            }
+
+            S21_TARGET_SSE4 inline bool equal(const int32_t *a, const int32_t *b, size_t n)
+            {
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i eq = _mm_cmpeq_epi32(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)));
+                    if (_mm_movemask_ps(_mm_castsi128_ps(eq)) != 0xF)
+                    {
+                        return false;
+                    }
+                }
+                return scalar::equal(a + i, b + i, n - i);
+            }
+
+            S21_TARGET_SSE4 inline bool equal(const float *a, const float *b, size_t n)
+            {
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+                    if (_mm_movemask_ps(eq) != 0xF)
+                    {
+                        return false;
+                    }
+                }
+                return scalar::equal(a + i, b + i, n - i);
+            }
+        }
+
+        namespace avx2
+        {
+            S21_TARGET_AVX2 inline const int32_t *find(const int32_t *p, size_t n,
+                                                       int32_t value)
+            {
+                const __m256i v = _mm256_set1_epi32(value);
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i eq = _mm256_cmpeq_epi32(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), v);
+                    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+                    if (mask)
+                    {
+                        return p + i + __builtin_ctz(mask);
+                    }
+                }
+                return scalar::find(p + i, n - i, value);
+            }
+
+            S21_TARGET_AVX2 inline const float *find(const float *p, size_t n,
+                                                     float value)
+            {
+                const __m256 v = _mm256_set1_ps(value);
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    int mask = _mm256_movemask_ps(
+                        _mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ));
+                    if (mask)
+                    {
+                        return p + i + __builtin_ctz(mask);
+                    }
+                }
+                return scalar::find(p + i, n - i, value);
+            }
+
+            S21_TARGET_AVX2 inline size_t count(const int32_t *p, size_t n,
+                                                int32_t value)
+            {
+                const __m256i v = _mm256_set1_epi32(value);
+                size_t result = 0;
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i eq = _mm256_cmpeq_epi32(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), v);
+                    result += __builtin_popcount(
+                        _mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+                }
+                return result + scalar::count(p + i, n - i, value);
+            }
+
+            S21_TARGET_AVX2 inline size_t count(const float *p, size_t n, float value)
+            {
+                const __m256 v = _mm256_set1_ps(value);
+                size_t result = 0;
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    result += __builtin_popcount(_mm256_movemask_ps(
+                        _mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ)));
+                }
+                return result + scalar::count(p + i, n - i, value);
+            }
+
+            S21_TARGET_AVX2 inline long long sum(const int32_t *p, size_t n)
+            {
+                __m256i acc0 = _mm256_setzero_si256();
+                __m256i acc1 = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm_loadu_si128(
+                                                      reinterpret_cast<const __m128i *>(p + i))));
+                    acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm_loadu_si128(
+                                                      reinterpret_cast<const __m128i *>(p + i + 4))));
+                }
+                alignas(32) long long lanes[4];
+                _mm256_store_si256(reinterpret_cast<__m256i *>(lanes),
+                                   _mm256_add_epi64(acc0, acc1));
+                return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                       scalar::sum(p + i, n - i);
+            }
+
+            S21_TARGET_AVX2 inline double sum(const float *p, size_t n)
+            {
+                __m256d acc0 = _mm256_setzero_pd();
+                __m256d acc1 = _mm256_setzero_pd();
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    acc0 = _mm256_add_pd(acc0, _mm256_cvtps_pd(_mm_loadu_ps(p + i)));
+                    acc1 = _mm256_add_pd(acc1, _mm256_cvtps_pd(_mm_loadu_ps(p + i + 4)));
+                }
+                alignas(32) double lanes[4];
+                _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+                return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                       scalar::sum(p + i, n - i);
+            }
+
+            S21_TARGET_AVX2 inline std::pair<int32_t, int32_t> min_max(const int32_t *p,
+                                                                       size_t n)
+            {
+                if (n < 8)
+                {
+                    return scalar::min_max(p, n);
+                }
+                __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                __m256i hi = lo;
+                size_t i = 8;
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                    lo = _mm256_min_epi32(lo, x);
+                    hi = _mm256_max_epi32(hi, x);
+                }
+                alignas(32) int32_t lo_lanes[8];
+                alignas(32) int32_t hi_lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i *>(lo_lanes), lo);
+                _mm256_store_si256(reinterpret_cast<__m256i *>(hi_lanes), hi);
+                std::pair<int32_t, int32_t> result = scalar::min_max(lo_lanes, 8);
+                result.second = scalar::min_max(hi_lanes, 8).second;
+                for (; i < n; ++i)
+                {
+                    result.first = p[i] < result.first ? p[i] : result.first;
+                    result.second = result.second < p[i] ? p[i] : result.second;
+                }
+                return result;
+            }
+
+            S21_TARGET_AVX2 inline std::pair<float, float> min_max(const float *p,
+                                                                   size_t n)
+            {
+                if (n < 8)
+                {
+                    return scalar::min_max(p, n);
+                }
+                __m256 lo = _mm256_loadu_ps(p);
+                __m256 hi = lo;
+                size_t i = 8;
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256 x = _mm256_loadu_ps(p + i);
+                    lo = _mm256_min_ps(lo, x);
+                    hi = _mm256_max_ps(hi, x);
+                }
+                alignas(32) float lo_lanes[8];
+                alignas(32) float hi_lanes[8];
+                _mm256_store_ps(lo_lanes, lo);
+                _mm256_store_ps(hi_lanes, hi);
+                std::pair<float, float> result = scalar::min_max(lo_lanes, 8);
+                result.second = scalar::min_max(hi_lanes, 8).second;
+                for (; i < n; ++i)
+                {
+                    result.first = p[i] < result.first ? p[i] : result.first;
+                    result.second = result.second < p[i] ? p[i] : result.second;
+                }
+                return result;
+            }
+
+            S21_TARGET_AVX2 inline bool equal(const int32_t *a, const int32_t *b, size_t n)
+            {
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i eq = _mm256_cmpeq_epi32(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)));
+                    if (_mm256_movemask_ps(_mm256_castsi256_ps(eq)) != 0xFF)
+                    {
+                        return false;
+                    }
+                }
+                return scalar::equal(a + i, b + i, n - i);
+            }
+
+            S21_TARGET_AVX2 inline bool equal(const float *a, const float *b, size_t n)
+            {
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(a + i),
+                                              _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+                    if (_mm256_movemask_ps(eq) != 0xFF)
+                    {
+                        return false;
+                    }
+                }
+                return scalar::equal(a + i, b + i, n - i);
+            }
+        }
+#endif
+
+        // есть ли для T векторные ядра
+        template <typename T>
+        inline constexpr bool kVectorized =
+            S21_SIMD_X86 && (std::is_same_v<T, int32_t> || std::is_same_v<T, float>);
+
+#if S21_SIMD_X86
+#define S21_SIMD_DISPATCH(T, call)                 \
+    if constexpr (kVectorized<T>)                  \
+    {                                              \
+        switch (active())                          \
+        {                                          \
+        case Level::kAvx2:                         \
+            return avx2::call;                     \
+        case Level::kSse4:                         \
+            return sse4::call;                     \
+        default:                                   \
+            break;                                 \
+        }                                          \
+    }
+#else
+#define S21_SIMD_DISPATCH(T, call)
+#endif
+
+        template <typename T>
+        const T *find(const T *p, size_t n, T value)
+        {
+            S21_SIMD_DISPATCH(T, find(p, n, value))
+            return scalar::find(p, n, value);
+        }
+
+        template <typename T>
+        size_t count(const T *p, size_t n, T value)
+        {
+            S21_SIMD_DISPATCH(T, count(p, n, value))
+            return scalar::count(p, n, value);
+        }
+
+        template <typename T>
+        sum_t<T> sum(const T *p, size_t n)
+        {
+            S21_SIMD_DISPATCH(T, sum(p, n))
+            return scalar::sum(p, n);
+        }
+
+        // n должно быть больше нуля
+        template <typename T>
+        std::pair<T, T> min_max(const T *p, size_t n)
+        {
+            S21_SIMD_DISPATCH(T, min_max(p, n))
+            return scalar::min_max(p, n);
+        }
+
+        template <typename T>
+        bool equal(const T *a, const T *b, size_t n)
+        {
+            S21_SIMD_DISPATCH(T, equal(a, b, n))
+            return scalar::equal(a, b, n);
+        }
+
+#undef S21_SIMD_DISPATCH
+
+        // Пословные операции над битовыми массивами (см. BitVector)
+        enum class BitOp
+        {
+            kAnd,
+            kOr,
+            kXor
+        };
+
+        namespace scalar
+        {
+            inline size_t popcount(const uint64_t *p, size_t n)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    result += __builtin_popcountll(p[i]);
+                }
+                return result;
+            }
+
+            template <BitOp Op>
+            void bitwise(uint64_t *dst, const uint64_t *src, size_t n)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if constexpr (Op == BitOp::kAnd)
+                    {
+                        dst[i] &= src[i];
+                    }
+                    else if constexpr (Op == BitOp::kOr)
+                    {
+                        dst[i] |= src[i];
+                    }
+                    else
+                    {
+                        dst[i] ^= src[i];
+                    }
+                }
+            }
+        }
+
+#if S21_SIMD_X86
+        namespace sse4
+        {
+            // четыре независимых popcnt за итерацию
+            S21_TARGET_SSE4 inline size_t popcount(const uint64_t *p, size_t n)
+            {
+                uint64_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    c0 += __builtin_popcountll(p[i]);
+                    c1 += __builtin_popcountll(p[i + 1]);
+                    c2 += __builtin_popcountll(p[i + 2]);
+                    c3 += __builtin_popcountll(p[i + 3]);
+                }
+                for (; i < n; ++i)
+                {
+                    c0 += __builtin_popcountll(p[i]);
+                }
+                return c0 + c1 + c2 + c3;
+            }
+
+            template <BitOp Op>
+            S21_TARGET_SSE4 void bitwise(uint64_t *dst, const uint64_t *src, size_t n)
+            {
+                size_t i = 0;
+                for (; i + 2 <= n; i += 2)
+                {
+                    __m128i *d = reinterpret_cast<__m128i *>(dst + i);
+                    __m128i a = _mm_loadu_si128(d);
+                    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    if constexpr (Op == BitOp::kAnd)
+                    {
+                        _mm_storeu_si128(d, _mm_and_si128(a, b));
+                    }
+                    else if constexpr (Op == BitOp::kOr)
+                    {
+                        _mm_storeu_si128(d, _mm_or_si128(a, b));
+                    }
+                    else
+                    {
+                        _mm_storeu_si128(d, _mm_xor_si128(a, b));
+                    }
+                }
+                scalar::bitwise<Op>(dst + i, src + i, n - i);
+            }
+        }
+
+        namespace avx2
+        {
+            // подсчёт через таблицу на полубайт (vpshufb) и vpsadbw
+            S21_TARGET_AVX2 inline size_t popcount(const uint64_t *p, size_t n)
+            {
+                const __m256i lookup = _mm256_setr_epi8(
+                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+                const __m256i low = _mm256_set1_epi8(0x0f);
+                __m256i total = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                    __m256i cnt = _mm256_add_epi8(
+                        _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low)),
+                        _mm256_shuffle_epi8(lookup,
+                                            _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+                    total = _mm256_add_epi64(total,
+                                             _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+                }
+                alignas(32) uint64_t lanes[4];
+                _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+                return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                       sse4::popcount(p + i, n - i);
+            }
+
+            template <BitOp Op>
+            S21_TARGET_AVX2 void bitwise(uint64_t *dst, const uint64_t *src, size_t n)
+            {
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m256i *d = reinterpret_cast<__m256i *>(dst + i);
+                    __m256i a = _mm256_loadu_si256(d);
+                    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                    if constexpr (Op == BitOp::kAnd)
+                    {
+                        _mm256_storeu_si256(d, _mm256_and_si256(a, b));
+                    }
+                    else if constexpr (Op == BitOp::kOr)
+                    {
+                        _mm256_storeu_si256(d, _mm256_or_si256(a, b));
+                    }
+                    else
+                    {
+                        _mm256_storeu_si256(d, _mm256_xor_si256(a, b));
+                    }
+                }
+                scalar::bitwise<Op>(dst + i, src + i, n - i);
+            }
+        }
+#endif
+
+        // число единичных бит в n словах
+        inline size_t popcount(const uint64_t *p, size_t n)
+        {
+#if S21_SIMD_X86
+            switch (active())
+            {
+            case Level::kAvx2:
+                return avx2::popcount(p, n);
+            case Level::kSse4:
+                return sse4::popcount(p, n);
+            default:
+                break;
+            }
+#endif
+            return scalar::popcount(p, n);
+        }
+
+        // dst[i] = dst[i] Op src[i]
+        template <BitOp Op>
+        void bitwise(uint64_t *dst, const uint64_t *src, size_t n)
+        {
+#if S21_SIMD_X86
+            switch (active())
+            {
+            case Level::kAvx2:
+                return avx2::bitwise<Op>(dst, src, n);
+            case Level::kSse4:
+                return sse4::bitwise<Op>(dst, src, n);
+            default:
+                break;
+            }
+#endif
+            scalar::bitwise<Op>(dst, src, n);
+        }
+    }
+
+    // Обёртки над simd:: для Vector арифметических типов. Искомое
+    // значение не участвует в выводе T и приводится к типу элемента,
+    // так что find(Vector<float>, 1.0) и count(Vector<int>, 5u) работают.
+
+    template <typename T, typename G, typename M>
+    typename Vector<T, G, M>::iterator find(Vector<T, G, M> &v,
+                                            const typename Vector<T, G, M>::value_type &value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "find requires an arithmetic type");
+        return v.data() + (simd::find(v.data(), v.size(), value) - v.data());
+    }
+
+    template <typename T, typename G, typename M>
+    size_t count(const Vector<T, G, M> &v,
+                 const typename Vector<T, G, M>::value_type &value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "count requires an arithmetic type");
+        return simd::count(v.data(), v.size(), value);
+    }
+
+    template <typename T, typename G, typename M>
+    bool contains(const Vector<T, G, M> &v,
+                  const typename Vector<T, G, M>::value_type &value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "contains requires an arithmetic type");
+        return simd::find(v.data(), v.size(), value) != v.data() + v.size();
+    }
+
+    template <typename T, typename G, typename M>
+    simd::sum_t<T> sum(const Vector<T, G, M> &v)
+    {
+        static_assert(std::is_arithmetic_v<T>, "sum requires an arithmetic type");
+        return simd::sum(v.data(), v.size());
+    }
+
+    template <typename T, typename G, typename M>
+    std::pair<T, T> min_max(const Vector<T, G, M> &v)
+    {
+        static_assert(std::is_arithmetic_v<T>, "min_max requires an arithmetic type");
+        if (v.empty())
+        {
+            throw std::out_of_range("Vector is empty");
+        }
+        return simd::min_max(v.data(), v.size());
+    }
+
+    template <typename T, typename G1, typename M1, typename G2, typename M2>
+    bool equal(const Vector<T, G1, M1> &a, const Vector<T, G2, M2> &b)
+    {
+        static_assert(std::is_arithmetic_v<T>, "equal requires an arithmetic type");
+        return a.size() == b.size() && simd::equal(a.data(), b.data(), a.size());
+    }
+}
+
+#endif // S21_VECTOR_SIMD_H